@@ -12,7 +12,9 @@
 #include <vector>
 #include <fstream>
 #include <sstream>
+#ifdef _WIN32
 #include "windows.h"
+#endif
 
 using std::string;
 using std::map;
@@ -20,6 +22,7 @@ using std::vector;
 
 void ReadCSVDataLine(string& line, D_TABLE& result);
 
+#ifdef _WIN32
 void ReadCSVFromResource(int resourceId, D_TABLE& result) {
     // \[Xnh̎擾
     HMODULE hModule = GetModuleHandle(NULL);
@@ -51,6 +54,7 @@ void ReadCSVFromResource(int resourceId, D_TABLE& result) {
 
     ReadCSVData(csvData, result);
 }
+#endif
 
 void ReadCSVFromPath(string path, D_TABLE& result) {
     std::ifstream file(path);
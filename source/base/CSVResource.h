@@ -17,7 +17,9 @@ typedef std::vector<D_ROW> D_TABLE;
 typedef std::map<std::string, std::string> D_KVPAIR;
 typedef std::map<std::string, D_KVPAIR> D_KVTABLE;
 
+#ifdef _WIN32
 void ReadCSVFromResource(int resourceId, D_TABLE& result);
+#endif
 void ReadCSVFromPath(std::string path, D_TABLE& result);
 void ReadCSVData(std::string& csvData, D_TABLE& result);
 void TableToKeyValuePair(const std::string key, D_TABLE& data_table, D_KVTABLE& result);
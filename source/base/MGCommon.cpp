@@ -11,7 +11,9 @@
 #include "audioTool.h"
 #include "resourceTool.h"
 #include <vector>
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -199,10 +201,10 @@ namespace MG {
 		// ςق1̏ꍇALERPɃtH[obN
 		if (dotProduct > 1.0f - EPSILON) {
 			Quaternion result;
-			result.w = (1 - t) * q1.w + t * q2Modified.w;
-			result.x = (1 - t) * q1.x + t * q2Modified.x;
-			result.y = (1 - t) * q1.y + t * q2Modified.y;
-			result.z = (1 - t) * q1.z + t * q2Modified.z;
+			result.w = (1 - t) * q0.w + t * q2Modified.w;
+			result.x = (1 - t) * q0.x + t * q2Modified.x;
+			result.y = (1 - t) * q0.y + t * q2Modified.y;
+			result.z = (1 - t) * q0.z + t * q2Modified.z;
 			result.Normalize();
 			return result;
 		}
@@ -216,11 +218,103 @@ namespace MG {
 		float w2 = sinf(t * theta) / sinTheta;
 
 		return {
-			w1 * q1.x + w2 * q2Modified.x,
-			w1 * q1.y + w2 * q2Modified.y,
-			w1 * q1.z + w2 * q2Modified.z,
-			w1 * q1.w + w2 * q2Modified.w
+			w1 * q0.x + w2 * q2Modified.x,
+			w1 * q0.y + w2 * q2Modified.y,
+			w1 * q0.z + w2 * q2Modified.z,
+			w1 * q0.w + w2 * q2Modified.w
+		};
+	}
+
+	Quaternion Nlerp(const Quaternion& q0, const Quaternion& q1, float t) {
+		float t1 = (Dot(q0, q1) < 0.0f) ? -t : t;
+		float t0 = 1.0f - t;
+		Quaternion result{
+			t0 * q0.x + t1 * q1.x,
+			t0 * q0.y + t1 * q1.y,
+			t0 * q0.z + t1 * q1.z,
+			t0 * q0.w + t1 * q1.w
 		};
+		result.Normalize();
+		return result;
+	}
+
+
+	// =======================================================
+	// Slerp̑ߎiD. EberlyuA Fast and Accurate Algorithm for Computing SLERPvj
+	// sin(t) / sin()x = cosƂ̑i8jŕ\AŌ̍͌덷ŏɂȂ悤ɕ␳
+	// ςȂq1𔽓]čŒZoHɁAx = 1ijł[ZȂ
+	// =======================================================
+	static constexpr float FAST_SLERP_MU = 1.85298109240830f;
+
+	static FAST_SLERP_COEFFICIENT CreateFastSlerpCoefficient()
+	{
+		FAST_SLERP_COEFFICIENT coefficient;
+		for (int i = 0; i < FAST_SLERP_TERM; i++) {
+			float scale = (i == FAST_SLERP_TERM - 1) ? FAST_SLERP_MU : 1.0f;
+			coefficient.u[i] = scale / ((i + 1) * (2 * i + 3));
+			coefficient.v[i] = scale * (i + 1) / (2 * i + 3);
+		}
+		return coefficient;
+	}
+	static const FAST_SLERP_COEFFICIENT g_fastSlerp = CreateFastSlerpCoefficient();
+
+	const FAST_SLERP_COEFFICIENT& GetFastSlerpCoefficient()
+	{
+		return g_fastSlerp;
+	}
+
+	Quaternion FastSlerp(const Quaternion& q0, const Quaternion& q1, float t) {
+		float x = Dot(q0, q1);
+		float sign = (x < 0.0f) ? -1.0f : 1.0f;
+		x *= sign;
+
+		float xm1 = x - 1.0f;
+		float d = 1.0f - t;
+		float t2 = t * t;
+		float d2 = d * d;
+		float c0 = 1.0f;
+		float c1 = 1.0f;
+		for (int i = FAST_SLERP_TERM - 1; i >= 0; i--) {
+			c0 = 1.0f + (g_fastSlerp.u[i] * d2 - g_fastSlerp.v[i]) * xm1 * c0;
+			c1 = 1.0f + (g_fastSlerp.u[i] * t2 - g_fastSlerp.v[i]) * xm1 * c1;
+		}
+		c0 *= d;
+		c1 *= sign * t;
+
+		return {
+			c0 * q0.x + c1 * q1.x,
+			c0 * q0.y + c1 * q1.y,
+			c0 * q0.z + c1 * q1.z,
+			c0 * q0.w + c1 * q1.w
+		};
+	}
+
+
+	// =======================================================
+	// NH[^jI̕ԕ@
+	// =======================================================
+	static QUATERNION_BLEND_MODE g_quaternionBlendMode = QUATERNION_BLEND_NLERP;
+
+	QUATERNION_BLEND_MODE GetQuaternionBlendMode()
+	{
+		return g_quaternionBlendMode;
+	}
+
+	void SetQuaternionBlendMode(QUATERNION_BLEND_MODE mode)
+	{
+		g_quaternionBlendMode = mode;
+	}
+
+	Quaternion BlendQuaternion(const Quaternion& q0, const Quaternion& q1, float t)
+	{
+		switch (g_quaternionBlendMode) {
+		case QUATERNION_BLEND_FAST_SLERP:
+			return FastSlerp(q0, q1, t);
+		case QUATERNION_BLEND_SLERP:
+			return Slerp(q0, q1, t);
+		default:
+			return Nlerp(q0, q1, t);
+		}
 	}
 
 	M4x4 Lerp(const M4x4& m0, const M4x4& m1, float t)
@@ -288,20 +382,69 @@ namespace MG {
 		return { r, g, b, a };
 	}
 
-	void ApplyAnimation(ANIMATION_CHANNEL* animationChannel, float frame, F3* size, F3* position, Quaternion* rotate) {
-		if (animationChannel->positionKeyNum && position) {
-			VECTOR_KEY* minKey = animationChannel->positionKeys;
-			VECTOR_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->positionKeyNum; i++) {
-				if (frame < animationChannel->positionKeys[i].frame) {
-					maxKey = (animationChannel->positionKeys + i);
-					break;
-				}
-				else {
-					minKey = (animationChannel->positionKeys + i);
-					maxKey = minKey;
+	// L[̃t[likgbN̓t[\̂́j
+	static float KeyFrame(const VECTOR_KEY& key) { return key.frame; }
+	static float KeyFrame(const QUATERNION_KEY& key) { return key.frame; }
+	static float KeyFrame(const float& frame) { return frame; }
+
+	// =======================================================
+	// frameȉ̍Ō̃L[ԍ񕪒T
+	// i擪L[Ȍꍇ0j
+	// =======================================================
+	template<typename KEY>
+	static unsigned int SearchKey(const KEY* keys, unsigned int keyNum, float frame)
+	{
+		unsigned int low = 0;
+		unsigned int high = keyNum;
+		while (low < high) {
+			unsigned int mid = (low + high) / 2;
+			if (frame < KeyFrame(keys[mid])) {
+				high = mid;
+			}
+			else {
+				low = mid + 1;
+			}
+		}
+		return (low > 0) ? low - 1 : 0;
+	}
+
+	// =======================================================
+	// ԂL[̃yAT
+	// 
+	// J[\ꍇ͑ŐԂmFA
+	// ĐŎ̋Ԃɐi񂾂ȂO(1)ōς܂
+	// V[NA[vAtĐ̏ꍇ͓񕪒TɃtH[obN
+	// =======================================================
+	template<typename KEY>
+	static void FindKeyPair(const KEY* keys, unsigned int keyNum, float frame, unsigned int* cursor, const KEY** minKey, const KEY** maxKey)
+	{
+		unsigned int index;
+		if (cursor && *cursor < keyNum && (*cursor == 0 || KeyFrame(keys[*cursor]) <= frame)) {
+			index = *cursor;
+			if (index + 1 < keyNum && KeyFrame(keys[index + 1]) <= frame) {
+				index++;
+				if (index + 1 < keyNum && KeyFrame(keys[index + 1]) <= frame) {
+					index = SearchKey(keys, keyNum, frame);
 				}
 			}
+		}
+		else {
+			index = SearchKey(keys, keyNum, frame);
+		}
+
+		if (cursor) {
+			*cursor = index;
+		}
+
+		*minKey = keys + index;
+		*maxKey = (index + 1 < keyNum && KeyFrame(keys[index]) <= frame) ? keys + index + 1 : keys + index;
+	}
+
+	void ApplyAnimation(const ANIMATION_CHANNEL* animationChannel, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor) {
+		if (animationChannel->positionKeyNum && position) {
+			const VECTOR_KEY* minKey;
+			const VECTOR_KEY* maxKey;
+			FindKeyPair(animationChannel->positionKeys, animationChannel->positionKeyNum, frame, cursor ? &cursor->positionKey : nullptr, &minKey, &maxKey);
 			float d = (maxKey->frame - minKey->frame);
 			if (d > 0.0f) {
 				float t = (frame - minKey->frame) / d;
@@ -313,18 +456,9 @@ namespace MG {
 		}
 
 		if (animationChannel->scalingKeyNum && size) {
-			VECTOR_KEY* minKey = animationChannel->scalingKeys;
-			VECTOR_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->scalingKeyNum; i++) {
-				if (frame < animationChannel->scalingKeys[i].frame) {
-					maxKey = (animationChannel->scalingKeys + i);
-					break;
-				}
-				else {
-					minKey = (animationChannel->scalingKeys + i);
-					maxKey = minKey;
-				}
-			}
+			const VECTOR_KEY* minKey;
+			const VECTOR_KEY* maxKey;
+			FindKeyPair(animationChannel->scalingKeys, animationChannel->scalingKeyNum, frame, cursor ? &cursor->scalingKey : nullptr, &minKey, &maxKey);
 			float d = (maxKey->frame - minKey->frame);
 			if (d > 0.0f) {
 				float t = (frame - minKey->frame) / d;
@@ -336,22 +470,13 @@ namespace MG {
 		}
 
 		if (animationChannel->rotationKeyNum && rotate) {
-			QUATERNION_KEY* minKey = animationChannel->rotationKeys;
-			QUATERNION_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->rotationKeyNum; i++) {
-				if (frame < animationChannel->rotationKeys[i].frame) {
-					maxKey = (animationChannel->rotationKeys + i);
-					break;
-				}
-				else {
-					minKey = (animationChannel->rotationKeys + i);
-					maxKey = minKey;
-				}
-			}
+			const QUATERNION_KEY* minKey;
+			const QUATERNION_KEY* maxKey;
+			FindKeyPair(animationChannel->rotationKeys, animationChannel->rotationKeyNum, frame, cursor ? &cursor->rotationKey : nullptr, &minKey, &maxKey);
 			float d = (maxKey->frame - minKey->frame);
 			if (d > 0.0f) {
 				float t = (frame - minKey->frame) / d;
-				*rotate = Lerp(minKey->rotate, maxKey->rotate, t);
+				*rotate = BlendQuaternion(minKey->rotate, maxKey->rotate, t);
 			}
 			else {
 				*rotate = minKey->rotate;
@@ -359,62 +484,306 @@ namespace MG {
 		}
 	}
 
-	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms) {
-		nodeWorldTransforms[currentNode] = (M4x4::ScalingMatrix(currentNode->scale) * M4x4::RotatingMatrix(currentNode->rotate) * M4x4::TranslatingMatrix(currentNode->position)) * worldTransform;
-		for (int i = 0; i < currentNode->childrenNum; i++) {
-			LoadNodeWorldTransforms(&currentNode->children[i], nodeWorldTransforms[currentNode], nodeWorldTransforms);
+	// =======================================================
+	// OG~[g
+	// Ԃ̗[̒lƐڐi1t[jAԒdŐڐXP[ĕ
+	// ]͐ƂɕԂĐKA
+	// ̃L[ἉȂlƐڐ𑵂̕
+	// =======================================================
+	struct HERMITE_WEIGHT {
+		float value0, tangent0, value1, tangent1;
+	};
+
+	static HERMITE_WEIGHT GetHermiteWeight(float t, float d)
+	{
+		float t2 = t * t;
+		float t3 = t2 * t;
+		return {
+			2.0f * t3 - 3.0f * t2 + 1.0f,
+			(t3 - 2.0f * t2 + t) * d,
+			-2.0f * t3 + 3.0f * t2,
+			(t3 - t2) * d
+		};
+	}
+
+	static F3 CubicVector(const VECTOR_KEY* keys, const F3* tangents, unsigned int keyNum, float frame, unsigned int* cursor)
+	{
+		const VECTOR_KEY* minKey;
+		const VECTOR_KEY* maxKey;
+		FindKeyPair(keys, keyNum, frame, cursor, &minKey, &maxKey);
+		float d = (maxKey->frame - minKey->frame);
+		if (d <= 0.0f) {
+			return minKey->vector;
 		}
+		HERMITE_WEIGHT w = GetHermiteWeight((frame - minKey->frame) / d, d);
+		const F3& m0 = tangents[minKey - keys];
+		const F3& m1 = tangents[maxKey - keys];
+		return minKey->vector * w.value0 + m0 * w.tangent0 + maxKey->vector * w.value1 + m1 * w.tangent1;
 	}
 
-	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms, const std::vector<ANIMATION_APPLICANT>& animationApplicants) {
+	void ApplyAnimation(const ANIMATION_CHANNEL* animationChannel, const CUBIC_CHANNEL* cubicChannel, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor)
+	{
+		if (animationChannel->positionKeyNum && position) {
+			*position = CubicVector(animationChannel->positionKeys, cubicChannel->positionTangents, animationChannel->positionKeyNum, frame, cursor ? &cursor->positionKey : nullptr);
+		}
+
+		if (animationChannel->scalingKeyNum && size) {
+			*size = CubicVector(animationChannel->scalingKeys, cubicChannel->scalingTangents, animationChannel->scalingKeyNum, frame, cursor ? &cursor->scalingKey : nullptr);
+		}
 
-		F3 size = currentNode->scale;
-		F3 position = currentNode->position;
-		Quaternion rotate = { currentNode->rotate.x, currentNode->rotate.y, currentNode->rotate.z, currentNode->rotate.w };
-		for (const ANIMATION_APPLICANT& applicant : animationApplicants) {
-			auto itr = applicant.animation->modelNodeChannels.find(currentNode->name);
-			if (itr != applicant.animation->modelNodeChannels.end()) {
-				ANIMATION_CHANNEL* animationChannel = itr->second;
-				ApplyAnimation(animationChannel, applicant.currentFrame, &size, &position, &rotate);
-				break;
+		if (animationChannel->rotationKeyNum && rotate) {
+			const QUATERNION_KEY* minKey;
+			const QUATERNION_KEY* maxKey;
+			FindKeyPair(animationChannel->rotationKeys, animationChannel->rotationKeyNum, frame, cursor ? &cursor->rotationKey : nullptr, &minKey, &maxKey);
+			float d = (maxKey->frame - minKey->frame);
+			if (d > 0.0f) {
+				HERMITE_WEIGHT w = GetHermiteWeight((frame - minKey->frame) / d, d);
+				const Quaternion& q0 = minKey->rotate;
+				const Quaternion& m0 = cubicChannel->rotationTangents[minKey - animationChannel->rotationKeys];
+				const Quaternion& q1 = maxKey->rotate;
+				const Quaternion& m1 = cubicChannel->rotationTangents[maxKey - animationChannel->rotationKeys];
+				float w1 = (Dot(q0, q1) < 0.0f) ? -w.value1 : w.value1;
+				float wm1 = (Dot(q0, q1) < 0.0f) ? -w.tangent1 : w.tangent1;
+				Quaternion result = {
+					q0.x * w.value0 + m0.x * w.tangent0 + q1.x * w1 + m1.x * wm1,
+					q0.y * w.value0 + m0.y * w.tangent0 + q1.y * w1 + m1.y * wm1,
+					q0.z * w.value0 + m0.z * w.tangent0 + q1.z * w1 + m1.z * wm1,
+					q0.w * w.value0 + m0.w * w.tangent0 + q1.w * w1 + m1.w * wm1
+				};
+				result.Normalize();
+				*rotate = result;
+			}
+			else {
+				*rotate = minKey->rotate;
 			}
 		}
-		nodeWorldTransforms[currentNode] = M4x4::ScalingMatrix(size) * M4x4::RotatingMatrix(rotate) * M4x4::TranslatingMatrix(position) * worldTransform;
+	}
 
-		for (int i = 0; i < currentNode->childrenNum; i++) {
-			LoadNodeWorldTransforms(&currentNode->children[i], nodeWorldTransforms[currentNode], nodeWorldTransforms, animationApplicants);
+	// =======================================================
+	// TvOς݃gbN̎Qƈʒu
+	// TɃt[璼ڃCfbNX߂
+	// =======================================================
+	static void GetTrackSample(const ANIMATION_TRACK& track, float frame, unsigned int* index0, unsigned int* index1, float* t)
+	{
+		float f = (frame > 0.0f) ? frame : 0.0f;
+		unsigned int index = (unsigned int)f;
+		if (index + 1 < track.sampleNum) {
+			*index0 = index;
+			*index1 = index + 1;
+			*t = f - (float)index;
+		}
+		else {
+			*index0 = track.sampleNum - 1;
+			*index1 = track.sampleNum - 1;
+			*t = 0.0f;
 		}
 	}
 
-	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms,
-		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t)
+	void ApplyAnimation(const RESAMPLED_CHANNEL* resampledChannel, float frame, F3* size, F3* position, Quaternion* rotate)
 	{
-		F3 size0 = currentNode->scale;
-		F3 position0 = currentNode->position;
-		Quaternion rotate0 = { currentNode->rotate.x, currentNode->rotate.y, currentNode->rotate.z, currentNode->rotate.w };
-		F3 size1 = currentNode->scale;
-		F3 position1 = currentNode->position;
-		Quaternion rotate1 = { currentNode->rotate.x, currentNode->rotate.y, currentNode->rotate.z, currentNode->rotate.w };
-		for (const ANIMATION_APPLICANT& applicant : animationSet0) {
-			auto itr = applicant.animation->modelNodeChannels.find(currentNode->name);
-			if (itr != applicant.animation->modelNodeChannels.end()) {
-				ANIMATION_CHANNEL* animationChannel = itr->second;
-				ApplyAnimation(animationChannel, applicant.currentFrame, &size0, &position0, &rotate0);
-				break;
+		unsigned int i0, i1;
+		float t;
+
+		const ANIMATION_TRACK& positionTrack = resampledChannel->position;
+		if (positionTrack.sampleNum && position) {
+			GetTrackSample(positionTrack, frame, &i0, &i1, &t);
+			*position = {
+				positionTrack.x[i0] + (positionTrack.x[i1] - positionTrack.x[i0]) * t,
+				positionTrack.y[i0] + (positionTrack.y[i1] - positionTrack.y[i0]) * t,
+				positionTrack.z[i0] + (positionTrack.z[i1] - positionTrack.z[i0]) * t
+			};
+		}
+
+		const ANIMATION_TRACK& scalingTrack = resampledChannel->scaling;
+		if (scalingTrack.sampleNum && size) {
+			GetTrackSample(scalingTrack, frame, &i0, &i1, &t);
+			*size = {
+				scalingTrack.x[i0] + (scalingTrack.x[i1] - scalingTrack.x[i0]) * t,
+				scalingTrack.y[i0] + (scalingTrack.y[i1] - scalingTrack.y[i0]) * t,
+				scalingTrack.z[i0] + (scalingTrack.z[i1] - scalingTrack.z[i0]) * t
+			};
+		}
+
+		const ANIMATION_TRACK& rotationTrack = resampledChannel->rotation;
+		if (rotationTrack.sampleNum && rotate) {
+			GetTrackSample(rotationTrack, frame, &i0, &i1, &t);
+			if (i0 == i1) {
+				*rotate = { rotationTrack.x[i0], rotationTrack.y[i0], rotationTrack.z[i0], rotationTrack.w[i0] };
+			}
+			else {
+				*rotate = BlendQuaternion(
+					Quaternion{ rotationTrack.x[i0], rotationTrack.y[i0], rotationTrack.z[i0], rotationTrack.w[i0] },
+					Quaternion{ rotationTrack.x[i1], rotationTrack.y[i1], rotationTrack.z[i1], rotationTrack.w[i1] },
+					t
+				);
 			}
 		}
-		for (const ANIMATION_APPLICANT& applicant : animationSet1) {
-			auto itr = applicant.animation->modelNodeChannels.find(currentNode->name);
-			if (itr != applicant.animation->modelNodeChannels.end()) {
-				ANIMATION_CHANNEL* animationChannel = itr->second;
-				ApplyAnimation(animationChannel, applicant.currentFrame, &size1, &position1, &rotate1);
-				break;
+	}
+
+	// =======================================================
+	// smallest-threeɂ]̗ʎq
+	// Βlő̗vf𐳂ɑďȂAc3vf
+	// [-1/2, 1/2]͈̔͂ŗʎqAȂvfԍ2bitɓ
+	// 48bitF15bit~3iunsigned short~3j
+	// 32bitF10bit~3iunsigned short~2j
+	// =======================================================
+	static const float SMALLEST_THREE_RANGE = 0.707106781f;
+
+	void PackQuaternion(const Quaternion& q, unsigned int bits, unsigned short* out)
+	{
+		float v[4] = { q.x, q.y, q.z, q.w };
+		unsigned int largest = 0;
+		for (unsigned int i = 1; i < 4; i++) {
+			if (fabsf(v[i]) > fabsf(v[largest])) {
+				largest = i;
 			}
 		}
-		nodeWorldTransforms[currentNode] = M4x4::ScalingMatrix(Lerp(size0, size1, t)) * M4x4::RotatingMatrix(Lerp(rotate0, rotate1, t)) * M4x4::TranslatingMatrix(Lerp(position0, position1, t)) * worldTransform;
+		float sign = (v[largest] < 0.0f) ? -1.0f : 1.0f;
+
+		unsigned int componentBits = (bits == 48) ? 15 : 10;
+		unsigned long long maxValue = (1ull << componentBits) - 1;
+		unsigned long long packed = largest;
+		for (unsigned int i = 0; i < 4; i++) {
+			if (i == largest) {
+				continue;
+			}
+			float normalized = (v[i] * sign + SMALLEST_THREE_RANGE) / (2.0f * SMALLEST_THREE_RANGE);
+			normalized = (normalized < 0.0f) ? 0.0f : (normalized > 1.0f) ? 1.0f : normalized;
+			packed = (packed << componentBits) | (unsigned long long)(normalized * maxValue + 0.5f);
+		}
+
+		if (bits == 48) {
+			out[0] = (unsigned short)(packed >> 32);
+			out[1] = (unsigned short)(packed >> 16);
+			out[2] = (unsigned short)packed;
+		}
+		else {
+			out[0] = (unsigned short)(packed >> 16);
+			out[1] = (unsigned short)packed;
+		}
+	}
+
+	Quaternion UnpackQuaternion(const unsigned short* in, unsigned int bits)
+	{
+		unsigned int componentBits;
+		unsigned long long packed;
+		if (bits == 48) {
+			componentBits = 15;
+			packed = ((unsigned long long)in[0] << 32) | ((unsigned long long)in[1] << 16) | in[2];
+		}
+		else {
+			componentBits = 10;
+			packed = ((unsigned long long)in[0] << 16) | in[1];
+		}
+		unsigned long long mask = (1ull << componentBits) - 1;
+		float scale = 2.0f * SMALLEST_THREE_RANGE / (float)mask;
+		unsigned int largest = (unsigned int)(packed >> (componentBits * 3)) & 3;
+
+		float v[4];
+		float sum = 0.0f;
+		int shift = componentBits * 2;
+		for (unsigned int i = 0; i < 4; i++) {
+			if (i == largest) {
+				continue;
+			}
+			v[i] = (float)((packed >> shift) & mask) * scale - SMALLEST_THREE_RANGE;
+			sum += v[i] * v[i];
+			shift -= componentBits;
+		}
+		v[largest] = (sum < 1.0f) ? sqrtf(1.0f - sum) : 0.0f;
+		return { v[0], v[1], v[2], v[3] };
+	}
 
-		for (int i = 0; i < currentNode->childrenNum; i++) {
-			LoadNodeWorldTransforms(&currentNode->children[i], nodeWorldTransforms[currentNode], nodeWorldTransforms, animationSet0, animationSet1, t);
+	// =======================================================
+	// ͈͂16bitɗʎq
+	// =======================================================
+	unsigned short PackRange(float value, float rangeMin, float rangeExtent)
+	{
+		if (rangeExtent <= 0.0f) {
+			return 0;
+		}
+		float normalized = (value - rangeMin) / rangeExtent;
+		normalized = (normalized < 0.0f) ? 0.0f : (normalized > 1.0f) ? 1.0f : normalized;
+		return (unsigned short)(normalized * 65535.0f + 0.5f);
+	}
+
+	F3 UnpackRange(const unsigned short* in, const F3& rangeMin, const F3& rangeExtent)
+	{
+		return {
+			rangeMin.x + rangeExtent.x * ((float)in[0] / 65535.0f),
+			rangeMin.y + rangeExtent.y * ((float)in[1] / 65535.0f),
+			rangeMin.z + rangeExtent.z * ((float)in[2] / 65535.0f)
+		};
+	}
+
+	// =======================================================
+	// kgbN̍Đ
+	// t[\ŋԂTAÕL[fR[hĕ
+	// ]smallest-threeŕĂ̂Ŕ␳
+	// =======================================================
+	static void FindCompressedKeyPair(const float* frames, unsigned int keyNum, float frame, unsigned int* cursor, unsigned int* index0, unsigned int* index1, float* t)
+	{
+		const float* minKey;
+		const float* maxKey;
+		FindKeyPair(frames, keyNum, frame, cursor, &minKey, &maxKey);
+		*index0 = (unsigned int)(minKey - frames);
+		*index1 = (unsigned int)(maxKey - frames);
+		float d = *maxKey - *minKey;
+		*t = (d > 0.0f) ? (frame - *minKey) / d : 0.0f;
+	}
+
+	static F3 DecodeCompressedVector(const COMPRESSED_ANIMATION* compressedAnimation, const COMPRESSED_TRACK& track, unsigned int index)
+	{
+		if (track.vectorBits == 96) {
+			const float* data = compressedAnimation->floats + track.dataOffset + index * 3;
+			return { data[0], data[1], data[2] };
+		}
+		const float* range = compressedAnimation->floats + track.rangeOffset;
+		F3 rangeMin = { range[0], range[1], range[2] };
+		F3 rangeExtent = { range[3], range[4], range[5] };
+		return UnpackRange(compressedAnimation->data + track.dataOffset + index * 3, rangeMin, rangeExtent);
+	}
+
+	static F3 SampleCompressedVector(const COMPRESSED_ANIMATION* compressedAnimation, const COMPRESSED_TRACK& track, float frame, unsigned int* cursor)
+	{
+		unsigned int i0, i1;
+		float t;
+		FindCompressedKeyPair(compressedAnimation->floats + track.frameOffset, track.keyNum, frame, cursor, &i0, &i1, &t);
+		F3 v0 = DecodeCompressedVector(compressedAnimation, track, i0);
+		if (i0 == i1) {
+			return v0;
+		}
+		F3 v1 = DecodeCompressedVector(compressedAnimation, track, i1);
+		return v0 * (1.0f - t) + v1 * t;
+	}
+
+	void ApplyAnimation(const COMPRESSED_ANIMATION* compressedAnimation, unsigned int channelIndex, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor)
+	{
+		const COMPRESSED_CHANNEL& compressedChannel = compressedAnimation->channels[channelIndex];
+
+		if (compressedChannel.position.keyNum && position) {
+			*position = SampleCompressedVector(compressedAnimation, compressedChannel.position, frame, cursor ? &cursor->positionKey : nullptr);
+		}
+
+		if (compressedChannel.scaling.keyNum && size) {
+			*size = SampleCompressedVector(compressedAnimation, compressedChannel.scaling, frame, cursor ? &cursor->scalingKey : nullptr);
+		}
+
+		const COMPRESSED_TRACK& rotationTrack = compressedChannel.rotation;
+		if (rotationTrack.keyNum && rotate) {
+			unsigned int i0, i1;
+			float t;
+			FindCompressedKeyPair(compressedAnimation->floats + rotationTrack.frameOffset, rotationTrack.keyNum, frame, cursor ? &cursor->rotationKey : nullptr, &i0, &i1, &t);
+			const unsigned short* data = compressedAnimation->data + rotationTrack.dataOffset;
+			unsigned int stride = rotationTrack.rotationBits / 16;
+			Quaternion q0 = UnpackQuaternion(data + i0 * stride, rotationTrack.rotationBits);
+			if (i0 == i1) {
+				*rotate = q0;
+			}
+			else {
+				Quaternion q1 = UnpackQuaternion(data + i1 * stride, rotationTrack.rotationBits);
+				*rotate = BlendQuaternion(q0, q1, t);	// ŒZoHւ̔]ōs
+			}
 		}
 	}
 
@@ -432,6 +801,18 @@ namespace MG {
 		return nullptr;
 	}
 
+	// =======================================================
+	// m[hȉ̑Sm[hig܂ށj
+	// =======================================================
+	unsigned int GetModelNodeNum(const MODEL_NODE* node)
+	{
+		unsigned int num = 1;
+		for (unsigned int i = 0; i < node->childrenNum; i++) {
+			num += GetModelNodeNum(node->children + i);
+		}
+		return num;
+	}
+
 
 	void SetRenderer(Renderer* renderer)
 	{
@@ -618,14 +999,19 @@ namespace MG {
 		g_resourceTool->ReleaseModel(scope);
 	}
 
-	Animation* LoadAnimation(const std::string& path, const std::string& scope)
+	Animation* LoadAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode, const std::string& rootMotion)
 	{
-		return g_resourceTool->LoadAnimation(path, scope);
+		return g_resourceTool->LoadAnimation(path, scope, mode, rootMotion);
 	}
 
-	void ReleaseAnimation(const std::string& path, const std::string& scope)
+	const AnimationBinding* GetAnimationBinding(const Model* model, const Animation* animation)
 	{
-		g_resourceTool->ReleaseAnimation(path, scope);
+		return g_resourceTool->GetAnimationBinding(model, animation);
+	}
+
+	void ReleaseAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode, const std::string& rootMotion)
+	{
+		g_resourceTool->ReleaseAnimation(path, scope, mode, rootMotion);
 	}
 
 	void ReleaseAnimation(const std::string& scope)
@@ -686,6 +1072,13 @@ namespace MG {
 		}
 	}
 
+	void DrawModel(const Model* model, const Pose& pose, const F4& color)
+	{
+		if (g_drawTool) {
+			g_drawTool->DrawModel(model, pose, color);
+		}
+	}
+
 	void DrawPolygon(const Texture* texture, const VERTEX* vertices, size_t length, TOPOLOGY topology, const F3& position, const F3& size, const Quaternion& rotate, const F4& color, const F2& uvOffset, const F2& uvRange)
 	{
 		if (g_drawTool) {
@@ -36,6 +36,9 @@ namespace MG {
 	class AudioPlayer;
 	class Model;
 	class Animation;
+	class AnimationCursor;
+	class AnimationBinding;
+	class Pose;
 
 	class Scene;
 	class SceneTransition;
@@ -60,18 +63,46 @@ namespace MG {
 	F3 Lerp(const F3& v0, const F3& v1, float t);
 	Quaternion Lerp(const Quaternion& q1, const Quaternion& q2, float t);
 	Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t);
+	Quaternion Nlerp(const Quaternion& q0, const Quaternion& q1, float t);		// ŒZoHɑLerp
+	Quaternion FastSlerp(const Quaternion& q0, const Quaternion& q1, float t);	// ߎSlerpi덷3e-5ȉj
+
+	// FastSlerp̑̌WiSIMDłƋLj
+	static constexpr int FAST_SLERP_TERM = 8;
+	struct FAST_SLERP_COEFFICIENT {
+		float u[FAST_SLERP_TERM];
+		float v[FAST_SLERP_TERM];
+	};
+	const FAST_SLERP_COEFFICIENT& GetFastSlerpCoefficient();
+
+	// Aj[V̕ԂƃuhŎgNH[^jI̕
+	enum QUATERNION_BLEND_MODE {
+		QUATERNION_BLEND_NLERP,			// NlerpiԑApx͈łȂj
+		QUATERNION_BLEND_FAST_SLERP,	// FastSlerpiz֐Ȃj
+		QUATERNION_BLEND_SLERP			// SlerpiacosAsinj
+	};
+	QUATERNION_BLEND_MODE GetQuaternionBlendMode();
+	void SetQuaternionBlendMode(QUATERNION_BLEND_MODE mode);
+	Quaternion BlendQuaternion(const Quaternion& q0, const Quaternion& q1, float t);	// I𒆂̃[hŕ
 	M4x4 Lerp(const M4x4& m0, const M4x4& m1, float t);
 	F3 Rotate(const F3& v, const Quaternion& q);
 	F3 Bezier(F3 p0, F3 p1, F3 p2, float t);
 	F4 HSV2RGB(float h, float s, float v, float a = 1.0f);
 
-	void ApplyAnimation(ANIMATION_CHANNEL* animationChannel, float frame, F3* size, F3* position, Quaternion* rotate);
+	void ApplyAnimation(const ANIMATION_CHANNEL* animationChannel, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor = nullptr);
+	void ApplyAnimation(const ANIMATION_CHANNEL* animationChannel, const CUBIC_CHANNEL* cubicChannel, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor = nullptr);
+	void ApplyAnimation(const RESAMPLED_CHANNEL* resampledChannel, float frame, F3* size, F3* position, Quaternion* rotate);
+	void ApplyAnimation(const COMPRESSED_ANIMATION* compressedAnimation, unsigned int channelIndex, float frame, F3* size, F3* position, Quaternion* rotate, CHANNEL_CURSOR* cursor = nullptr);
+	void PackQuaternion(const Quaternion& q, unsigned int bits, unsigned short* out);
+	Quaternion UnpackQuaternion(const unsigned short* in, unsigned int bits);
+	unsigned short PackRange(float value, float rangeMin, float rangeExtent);
+	F3 UnpackRange(const unsigned short* in, const F3& rangeMin, const F3& rangeExtent);
 	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms);
 	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms, 
 		const std::vector<ANIMATION_APPLICANT>& animationApplicants);
 	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms, 
 		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t);
 	MODEL_NODE* FindNodeByName(MODEL_NODE* root, const std::string& name);
+	unsigned int GetModelNodeNum(const MODEL_NODE* node);
 
 	void SetRenderer(Renderer* renderer);
 	Renderer* GetRenderer();
@@ -109,8 +140,9 @@ namespace MG {
 	void ReleaseModel(const std::string& path, const std::string& scope);
 	void ReleaseModel(const std::string& scope);
 
-	Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL);
-	void ReleaseAnimation(const std::string& path, const std::string& scope);
+	Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL, ANIMATION_LOAD_MODE mode = ANIMATION_LOAD_MODE_KEY, const std::string& rootMotion = "");
+	const AnimationBinding* GetAnimationBinding(const Model* model, const Animation* animation);
+	void ReleaseAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode = ANIMATION_LOAD_MODE_KEY, const std::string& rootMotion = "");
 	void ReleaseAnimation(const std::string& scope);
 
 	void ReleaseResource(Resource* resource, const std::string& scope);
@@ -161,6 +193,12 @@ namespace MG {
 		const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }
 	);
 
+	void DrawModel(
+		const Model* model,
+		const Pose& pose,
+		const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }
+	);
+
 	void DrawPolygon(const Texture* texture, const VERTEX* vertices, size_t length,
 		TOPOLOGY topology = TOPOLOGY_TRIANGLESTRIP,
 		const F3& position = { 0.0f, 0.0f, 0.0f },
@@ -10,6 +10,7 @@
 #include "MGCommon.h"
 #include <string>
 #include <fstream>
+#include <cstring>
 #include <list>
 
 namespace MG {
@@ -258,7 +259,7 @@ namespace MG {
 		float R21 = 2.0f * y * z + 2.0f * x * w;
 		float R22 = 2.0f * w * w + 2.0f * z * z - 1.0f;
 
-		float pitch = std::asinf(-R12);
+		float pitch = asinf(-R12);
 		float yaw;
 		float roll;
 		if (std::abs(pitch) > 0.9999f) {
@@ -11,6 +11,11 @@
 #include "MGObject.h"
 #include <math.h>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define MG_DATA_TYPE_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace MG {
 
 	constexpr const char* FONT_YU_GOTHIC = "Yu Gothic";							// SVbN
@@ -179,6 +184,33 @@ namespace MG {
 			};
 		}
 
+		// ScalingMatrix(scale) * RotatingMatrix(rotate) * TranslatingMatrix(position)Ɠʂ
+		// s̊|ZȂŒڍ
+		static M4x4 FromTRS(const F3& scale, const Quaternion& rotate, const F3& position) {
+			float xx = 2.0f * rotate.x * rotate.x, yy = 2.0f * rotate.y * rotate.y, zz = 2.0f * rotate.z * rotate.z;
+			float xy = 2.0f * rotate.x * rotate.y, xz = 2.0f * rotate.x * rotate.z, yz = 2.0f * rotate.y * rotate.z;
+			float xw = 2.0f * rotate.x * rotate.w, yw = 2.0f * rotate.y * rotate.w, zw = 2.0f * rotate.z * rotate.w;
+			return {
+				(1.0f - yy - zz) * scale.x,	(xy - zw) * scale.y,		(xz + yw) * scale.z,		position.x,
+				(xy + zw) * scale.x,		(1.0f - xx - zz) * scale.y,	(yz - xw) * scale.z,		position.y,
+				(xz - yw) * scale.x,		(yz + xw) * scale.y,		(1.0f - xx - yy) * scale.z,	position.z,
+				0.0f,						0.0f,						0.0f,						1.0f
+			};
+		}
+
+		// FromTRS(scale, rotate, position) * parentƓ
+		// [Js̍Ō̍s(0,0,0,1)Ȃ̂ŁÅ̕|ZȂ
+		static M4x4 FromTRS(const F3& scale, const Quaternion& rotate, const F3& position, const M4x4& parent) {
+			M4x4 l = FromTRS(scale, rotate, position);
+			const M4x4& p = parent;
+			return {
+				p._v00 * l._v00 + p._v01 * l._v10 + p._v02 * l._v20,    p._v00 * l._v01 + p._v01 * l._v11 + p._v02 * l._v21,    p._v00 * l._v02 + p._v01 * l._v12 + p._v02 * l._v22,    p._v00 * l._v03 + p._v01 * l._v13 + p._v02 * l._v23 + p._v03,
+				p._v10 * l._v00 + p._v11 * l._v10 + p._v12 * l._v20,    p._v10 * l._v01 + p._v11 * l._v11 + p._v12 * l._v21,    p._v10 * l._v02 + p._v11 * l._v12 + p._v12 * l._v22,    p._v10 * l._v03 + p._v11 * l._v13 + p._v12 * l._v23 + p._v13,
+				p._v20 * l._v00 + p._v21 * l._v10 + p._v22 * l._v20,    p._v20 * l._v01 + p._v21 * l._v11 + p._v22 * l._v21,    p._v20 * l._v02 + p._v21 * l._v12 + p._v22 * l._v22,    p._v20 * l._v03 + p._v21 * l._v13 + p._v22 * l._v23 + p._v23,
+				p._v30 * l._v00 + p._v31 * l._v10 + p._v32 * l._v20,    p._v30 * l._v01 + p._v31 * l._v11 + p._v32 * l._v21,    p._v30 * l._v02 + p._v31 * l._v12 + p._v32 * l._v22,    p._v30 * l._v03 + p._v31 * l._v13 + p._v32 * l._v23 + p._v33,
+			};
+		}
+
 		M4x4 operator *(const M4x4& m) const {
 			return {
 				m._v00 * _v00 + m._v01 * _v10 + m._v02 * _v20 + m._v03 * _v30,    m._v00 * _v01 + m._v01 * _v11 + m._v02 * _v21 + m._v03 * _v31,    m._v00 * _v02 + m._v01 * _v12 + m._v02 * _v22 + m._v03 * _v32,    m._v00 * _v03 + m._v01 * _v13 + m._v02 * _v23 + m._v03 * _v33,
@@ -285,6 +317,136 @@ namespace MG {
 		}
 	};
 
+	// =======================================================
+	// AtBϊsiM4x4̏3sj
+	// Ō̍s͏(0,0,0,1)Ȃ̂ŎȂ
+	// |Z̏ԂƐ̕тM4x4Ɠ
+	// =======================================================
+	struct M3x4 {
+		float	_v00, _v01, _v02, _v03,
+				_v10, _v11, _v12, _v13,
+				_v20, _v21, _v22, _v23;
+
+		static M3x4 Identity() {
+			return {
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, 0.0f
+			};
+		}
+
+		// Ō̍ŝ͎Ăiˉe܂ލs͕ϊłȂj
+		static M3x4 FromM4x4(const M4x4& m) {
+			return {
+				m._v00, m._v01, m._v02, m._v03,
+				m._v10, m._v11, m._v12, m._v13,
+				m._v20, m._v21, m._v22, m._v23
+			};
+		}
+
+		M4x4 ToM4x4() const {
+			return {
+				_v00, _v01, _v02, _v03,
+				_v10, _v11, _v12, _v13,
+				_v20, _v21, _v22, _v23,
+				0.0f, 0.0f, 0.0f, 1.0f
+			};
+		}
+
+		static M3x4 FromTRS(const F3& scale, const Quaternion& rotate, const F3& position) {
+			float xx = 2.0f * rotate.x * rotate.x, yy = 2.0f * rotate.y * rotate.y, zz = 2.0f * rotate.z * rotate.z;
+			float xy = 2.0f * rotate.x * rotate.y, xz = 2.0f * rotate.x * rotate.z, yz = 2.0f * rotate.y * rotate.z;
+			float xw = 2.0f * rotate.x * rotate.w, yw = 2.0f * rotate.y * rotate.w, zw = 2.0f * rotate.z * rotate.w;
+			return {
+				(1.0f - yy - zz) * scale.x,	(xy - zw) * scale.y,		(xz + yw) * scale.z,		position.x,
+				(xy + zw) * scale.x,		(1.0f - xx - zz) * scale.y,	(yz - xw) * scale.z,		position.y,
+				(xz - yw) * scale.x,		(yz + xw) * scale.y,		(1.0f - xx - yy) * scale.z,	position.z
+			};
+		}
+
+		static M3x4 FromTRS(const F3& scale, const Quaternion& rotate, const F3& position, const M3x4& parent) {
+			return FromTRS(scale, rotate, position) * parent;
+		}
+
+		// thisɁAmɓKpiM4x4Ɠj
+		// ʂis = this3s̐` + (0,0,0,m._vi3) Ȃ̂ŁASSEł͍sƂɌvZ
+		M3x4 operator *(const M3x4& m) const {
+#ifdef MG_DATA_TYPE_SSE
+			__m128 row0 = _mm_loadu_ps(&_v00);
+			__m128 row1 = _mm_loadu_ps(&_v10);
+			__m128 row2 = _mm_loadu_ps(&_v20);
+			M3x4 result;
+			_mm_storeu_ps(&result._v00, _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v00), row0), _mm_mul_ps(_mm_set1_ps(m._v01), row1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v02), row2), _mm_set_ps(m._v03, 0.0f, 0.0f, 0.0f))));
+			_mm_storeu_ps(&result._v10, _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v10), row0), _mm_mul_ps(_mm_set1_ps(m._v11), row1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v12), row2), _mm_set_ps(m._v13, 0.0f, 0.0f, 0.0f))));
+			_mm_storeu_ps(&result._v20, _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v20), row0), _mm_mul_ps(_mm_set1_ps(m._v21), row1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m._v22), row2), _mm_set_ps(m._v23, 0.0f, 0.0f, 0.0f))));
+			return result;
+#else
+			return {
+				m._v00 * _v00 + m._v01 * _v10 + m._v02 * _v20,    m._v00 * _v01 + m._v01 * _v11 + m._v02 * _v21,    m._v00 * _v02 + m._v01 * _v12 + m._v02 * _v22,    m._v00 * _v03 + m._v01 * _v13 + m._v02 * _v23 + m._v03,
+				m._v10 * _v00 + m._v11 * _v10 + m._v12 * _v20,    m._v10 * _v01 + m._v11 * _v11 + m._v12 * _v21,    m._v10 * _v02 + m._v11 * _v12 + m._v12 * _v22,    m._v10 * _v03 + m._v11 * _v13 + m._v12 * _v23 + m._v13,
+				m._v20 * _v00 + m._v21 * _v10 + m._v22 * _v20,    m._v20 * _v01 + m._v21 * _v11 + m._v22 * _v21,    m._v20 * _v02 + m._v21 * _v12 + m._v22 * _v22,    m._v20 * _v03 + m._v21 * _v13 + m._v22 * _v23 + m._v23
+			};
+#endif
+		}
+
+		void operator *=(const M3x4& m) {
+			*this = *this * m;
+		}
+
+		F3 operator *(const F3& v) const {
+			return {
+				v.x * _v00 + v.y * _v01 + v.z * _v02 + _v03,
+				v.x * _v10 + v.y * _v11 + v.z * _v12 + _v13,
+				v.x * _v20 + v.y * _v21 + v.z * _v22 + _v23
+			};
+		}
+
+		F3 TransformNormal(const F3& v) const {
+			return {
+				v.x * _v00 + v.y * _v01 + v.z * _v02,
+				v.x * _v10 + v.y * _v11 + v.z * _v12,
+				v.x * _v20 + v.y * _v21 + v.z * _v22
+			};
+		}
+
+		// 3x3̋tsƁAt̕sړ
+		M3x4 Inverse() const {
+			float c00 = _v11 * _v22 - _v12 * _v21;
+			float c01 = _v12 * _v20 - _v10 * _v22;
+			float c02 = _v10 * _v21 - _v11 * _v20;
+
+			float determinant = _v00 * c00 + _v01 * c01 + _v02 * c02;
+
+			if (determinant == 0.0f) {
+				return *this;
+			}
+
+			float invDet = 1.0f / determinant;
+
+			float i00 = c00 * invDet;
+			float i01 = (_v02 * _v21 - _v01 * _v22) * invDet;
+			float i02 = (_v01 * _v12 - _v02 * _v11) * invDet;
+			float i10 = c01 * invDet;
+			float i11 = (_v00 * _v22 - _v02 * _v20) * invDet;
+			float i12 = (_v02 * _v10 - _v00 * _v12) * invDet;
+			float i20 = c02 * invDet;
+			float i21 = (_v01 * _v20 - _v00 * _v21) * invDet;
+			float i22 = (_v00 * _v11 - _v01 * _v10) * invDet;
+
+			return {
+				i00, i01, i02, -(i00 * _v03 + i01 * _v13 + i02 * _v23),
+				i10, i11, i12, -(i10 * _v03 + i11 * _v13 + i12 * _v23),
+				i20, i21, i22, -(i20 * _v03 + i21 * _v13 + i22 * _v23)
+			};
+		}
+	};
+
 	struct VERTEX {
 		F3 position;
 		F3 normal;
@@ -336,8 +498,7 @@ namespace MG {
 	};
 
 	struct MESH_BONE {
-		M4x4 offset;
-		M4x4 world;
+		M3x4 offset;
 		MODEL_NODE* node;
 	};
 
@@ -367,6 +528,13 @@ namespace MG {
 		Quaternion rotate;
 	};
 
+	// L[Ԃ̒TJ[\AO񌩂Ԃ̐擪L[ԍ
+	struct CHANNEL_CURSOR {
+		unsigned int positionKey = 0;
+		unsigned int scalingKey = 0;
+		unsigned int rotationKey = 0;
+	};
+
 	struct ANIMATION_CHANNEL {
 		unsigned int positionKeyNum;
 		unsigned int scalingKeyNum;
@@ -379,6 +547,90 @@ namespace MG {
 		const char* nodeName;
 	};
 
+	// ԊuŃTvOgbNiSoAj
+	// Tvi̓t[i̒lAsampleNum1Ȃ萔gbN
+	struct ANIMATION_TRACK {
+		unsigned int sampleNum = 0;
+		float* x = nullptr;
+		float* y = nullptr;
+		float* z = nullptr;
+		float* w = nullptr;		// ]gbN̂
+	};
+
+	struct RESAMPLED_CHANNEL {
+		ANIMATION_TRACK position;
+		ANIMATION_TRACK scaling;
+		ANIMATION_TRACK rotation;
+	};
+
+	// OG~[gԂ̐ڐi1t[̕ωʁj
+	// L[ƓтŁAL[ȂgbNnullptr
+	struct CUBIC_CHANNEL {
+		const F3* positionTangents = nullptr;
+		const F3* scalingTangents = nullptr;
+		const Quaternion* rotationTangents = nullptr;
+	};
+
+	// kgbN
+	// ʒuEXP[͔͈͂16bitɗʎqiL[Ƃ3vfjA
+	// ͈͂Lėʎq덷e͈͂𒴂Ȃfloat̂܂܁ifloatsɃL[Ƃ3vfj
+	// ]smallest-three48biti3vfj32biti2vfj
+	// t[\Á͈Aʎqf[^̓Nbv̋Lv[ւ̃ItZbgŁA
+	// e͈ɂ܂Ƃ߂
+	struct COMPRESSED_TRACK {
+		unsigned int keyNum = 0;
+		unsigned int frameOffset = 0;	// floatsAkeyNum
+		unsigned int rangeOffset = 0;	// floatsAŏlxyzƕxyziʒuEXP[̂݁j
+		unsigned int dataOffset = 0;	// dataAfloat̂܂܂Ȃfloats
+		unsigned int vectorBits = 0;	// ʒuEXP[̂݁A48iʎqj96ifloatj
+		unsigned int rotationBits = 0;	// ]̂݁A4832
+	};
+
+	struct COMPRESSED_CHANNEL {
+		COMPRESSED_TRACK position;
+		COMPRESSED_TRACK scaling;
+		COMPRESSED_TRACK rotation;
+	};
+
+	struct COMPRESSED_ANIMATION {
+		unsigned int channelNum = 0;
+		const COMPRESSED_CHANNEL* channels = nullptr;
+		const float* floats = nullptr;
+		const unsigned short* data = nullptr;
+	};
+
+	// {[Ƃ̋e덷
+	struct ANIMATION_ERROR_BUDGET {
+		float position = 0.001f;
+		float scaling = 0.001f;
+		float rotation = 0.005f;	// WA
+	};
+
+	enum ANIMATION_LOAD_MODE {
+		ANIMATION_LOAD_MODE_KEY,		// L[t[̂܂܁iTĕԁj
+		ANIMATION_LOAD_MODE_RESAMPLE,	// t[[gŃTvOiCfbNXڎQƁÃL[͉j
+		ANIMATION_LOAD_MODE_COMPRESS,	// e덷ŃL[팸AʎqiĐɃfR[hÃL[͉j
+		ANIMATION_LOAD_MODE_CUBIC		// L[t[̂܂܁AڐOvZĎOԁiL[xďoNbvj
+	};
+
+	// ۑ`Ƃ̃ʂƁAL[t[ɑ΂ő덷
+	// residentBytes͎ۂɎĂ郁iL[t[̃obt@܂ށAς݂Ȃ܂܂Ȃj
+	struct ANIMATION_STORAGE_REPORT {
+		size_t keyBytes = 0;
+		size_t bytes = 0;
+		size_t residentBytes = 0;
+		float maxPositionError = 0.0f;
+		float maxScalingError = 0.0f;
+		float maxRotationError = 0.0f;	// WA
+	};
+
+	// [g[V̍
+	// Jnt[ł̃LN^[̌ɂ[Jԁi[gm[h̐eԂ̐ʁj
+	struct ROOT_MOTION_DELTA {
+		F3 position = {};
+		float yaw = 0.0f;		// YAWAiQuaternion::AxisYRadianƓj
+	};
+
 	struct ANIMATION {
 		float frameRate;
 		float frames;
@@ -450,9 +702,25 @@ namespace MG {
 	ARRANGEMENT* GetArrangementByMGObject(const MGObject& mgo);
 
 	class Animation;
+	class AnimationCursor;
+	class AnimationBinding;
+	class BoneMask;
+
+	// C[̏d˕
+	enum ANIMATION_LAYER {
+		ANIMATION_LAYER_OVERRIDE,	// ̎pd݂Œu
+		ANIMATION_LAYER_ADDITIVE	// t[Ƃ̍̎pɑ
+	};
+
 	struct ANIMATION_APPLICANT {
 		const Animation* animation = nullptr;
 		const float currentFrame;
+		AnimationCursor* cursor = nullptr;	// ȗ͖񕪒T
+		const AnimationBinding* binding = nullptr;	// ȗ̓m[hŃ`l
+		float weight = 1.0f;	// dݕtuhAC[p
+		const BoneMask* mask = nullptr;	// ȗ͑Sm[hAOꂽm[h̓TvOȂ
+		ANIMATION_LAYER layer = ANIMATION_LAYER_OVERRIDE;	// ApplyNodeLayersp
+		float referenceFrame = 0.0f;	// ZC[̊t[
 	};
 
 } // namespace MG
@@ -33,5 +33,20 @@ namespace MG {
 
 		return mgo;
 	}
+
+	// LoadMGOƓсiMGObjecťɃf[^j
+	bool SaveMGO(const char* fileName, const MGObject& mgo) {
+		std::ofstream file(fileName, std::ios::binary);
+		if (!file) {
+			return false;
+		}
+
+		MGObject header = mgo;
+		header.data = nullptr;
+		file.write(reinterpret_cast<const char*>(&header), sizeof(MGObject));
+		file.write(mgo.data, mgo.size);
+
+		return file.good();
+	}
 }
 
@@ -8,6 +8,8 @@
 #ifndef _MG_OBJECT_H
 #define _MG_OBJECT_H
 
+#include <stddef.h>
+
 namespace MG {
 
 	enum MGOBJECT_TYPE {
@@ -26,6 +28,7 @@ namespace MG {
 	};
 
 	MGObject LoadMGO(const char* fileName);
+	bool SaveMGO(const char* fileName, const MGObject& mgo);
 
 } // namespace MG
 
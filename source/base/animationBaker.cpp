@@ -0,0 +1,255 @@
+// =======================================================
+// animationBaker.cpp
+//
+// Aj[ṼxCN
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "animationBaker.h"
+#include "resourceTool.h"
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+
+namespace MG {
+
+	// eNZ̐擪𑵂
+	static constexpr size_t BAKED_TEXEL_ALIGN = 16;
+
+	static unsigned int GetBakedRowNum(const Animation* animation, float sampleRate)
+	{
+		const ANIMATION* rawAnimation = animation->rawAnimation;
+		if (rawAnimation->frameRate <= 0.0f || rawAnimation->frames <= 0.0f) {
+			return 1;
+		}
+		return (unsigned int)floorf(rawAnimation->frames / rawAnimation->frameRate * sampleRate) + 1;
+	}
+
+	static void WriteTexel(float* texel, const F3& v, float w)
+	{
+		texel[0] = v.x;
+		texel[1] = v.y;
+		texel[2] = v.z;
+		texel[3] = w;
+	}
+
+
+	// =======================================================
+	// xCN
+	// 1. Nbv̍sAim[hAbVj̕т傫߂Ĉꊇm
+	// 2. NbvƂɃTv̎p߂āAs
+	// =======================================================
+	MGObject BakeAnimations(const Model* model, const std::vector<const Animation*>& animations, BAKE_MODE mode, float sampleRate, BAKE_STATS* stats)
+	{
+		auto start = std::chrono::steady_clock::now();
+		MODEL_NODE* nodes = model->rawModel->rootNode;
+		unsigned int nodeNum = model->nodeNum;
+
+		// `悷im[hAbVjƃXLbṼ{[
+		std::vector<BAKED_ITEM> items;
+		std::vector<std::vector<MESH_BONE>> itemBones;
+		unsigned int vertexNum = 0;
+		if (mode == BAKE_MODE_VERTEX) {
+			std::unordered_map<std::string, MODEL_NODE*> nameNodeMap;
+			for (unsigned int n = 0; n < nodeNum; n++) {
+				nameNodeMap[nodes[n].name] = nodes + n;
+			}
+			for (unsigned int n = 0; n < nodeNum; n++) {
+				for (unsigned int m = 0; m < nodes[n].meshNum; m++) {
+					unsigned int meshIndex = nodes[n].meshIndexes[m];
+					const MESH* mesh = model->rawModel->meshes + meshIndex;
+					if (mesh->primitiveType != PRIMITIVE_TYPE_TRIANGLE) {
+						continue;
+					}
+					items.push_back({ n, meshIndex, vertexNum, mesh->vertexNum });
+					itemBones.emplace_back();
+					for (unsigned int b = 0; b < mesh->boneNum; b++) {
+						itemBones.back().push_back({ M3x4::FromM4x4(mesh->bones[b].transform), nameNodeMap[mesh->bones[b].name] });
+					}
+					vertexNum += mesh->vertexNum;
+				}
+			}
+		}
+
+		unsigned int width = (mode == BAKE_MODE_NODE_MATRIX) ? nodeNum * 3 : vertexNum * 2;
+		unsigned int height = 0;
+		std::vector<unsigned int> rowNums;
+		for (const Animation* animation : animations) {
+			rowNums.push_back(GetBakedRowNum(animation, sampleRate));
+			height += rowNums.back();
+		}
+
+		size_t headerBytes = sizeof(BAKED_ANIMATION) + sizeof(BAKED_CLIP) * animations.size() + sizeof(BAKED_ITEM) * items.size();
+		size_t texelOffset = (headerBytes + BAKED_TEXEL_ALIGN - 1) / BAKED_TEXEL_ALIGN * BAKED_TEXEL_ALIGN;
+		size_t atlasBytes = sizeof(float) * 4 * (size_t)width * height;
+
+		MGObject mgo = {};
+		mgo.type = MGOBJECT_TYPE_DATA;
+		mgo.size = texelOffset + atlasBytes;
+		mgo.data = new char[mgo.size];
+		memset(mgo.data, 0, texelOffset);
+
+		BAKED_ANIMATION* baked = (BAKED_ANIMATION*)mgo.data;
+		baked->mode = mode;
+		baked->width = width;
+		baked->height = height;
+		baked->nodeNum = nodeNum;
+		baked->vertexNum = vertexNum;
+		baked->sampleRate = sampleRate;
+		baked->clipNum = (unsigned int)animations.size();
+		baked->itemNum = (unsigned int)items.size();
+		GetBakedAnimationByMGObject(mgo);
+		if (!items.empty()) {
+			memcpy(baked->items, items.data(), sizeof(BAKED_ITEM) * items.size());
+		}
+
+		Pose pose;
+		Pose bindPose;
+		LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), bindPose);
+		std::vector<M3x4> palette;
+		std::vector<F3> positions;
+		std::vector<F3> normals;
+
+		unsigned int row = 0;
+		for (unsigned int c = 0; c < animations.size(); c++) {
+			const Animation* animation = animations[c];
+			BAKED_CLIP& clip = baked->clips[c];
+			const char* name = animation->rawAnimation->name ? animation->rawAnimation->name : "";
+			strncpy(clip.name, name, BAKED_CLIP_NAME_MAX - 1);
+			clip.firstRow = row;
+			clip.rowNum = rowNums[c];
+			clip.frames = animation->rawAnimation->frames;
+			clip.frameRate = animation->rawAnimation->frameRate;
+
+			AnimationBinding binding(model, animation);
+			AnimationCursor cursor;
+			for (unsigned int s = 0; s < clip.rowNum; s++, row++) {
+				float frame = (sampleRate > 0.0f) ? std::min(s * clip.frameRate / sampleRate, clip.frames) : 0.0f;
+				std::vector<ANIMATION_APPLICANT> applicants = { { animation, frame, &cursor, &binding } };
+				LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), pose, applicants);
+
+				float* texels = baked->texels + (size_t)row * width * 4;
+				if (mode == BAKE_MODE_NODE_MATRIX) {
+					memcpy(texels, pose.GetWorlds(), sizeof(M3x4) * nodeNum);
+					continue;
+				}
+
+				for (unsigned int i = 0; i < items.size(); i++) {
+					const BAKED_ITEM& item = items[i];
+					const MESH* mesh = model->rawModel->meshes + item.meshIndex;
+					float* positionTexels = texels + (size_t)item.firstVertex * 4;
+					float* normalTexels = texels + ((size_t)vertexNum + item.firstVertex) * 4;
+					if (mesh->boneNum > 0) {
+						// DrawToolDXƓAXLjǑɃm[h̃oCh|[Ỹ[hs|
+						palette.resize(mesh->boneNum);
+						positions.resize(mesh->vertexNum);
+						normals.resize(mesh->vertexNum);
+						BuildSkinPalette(model, pose, itemBones[i].data(), mesh->boneNum, palette.data());
+						SkinMesh(mesh, palette.data(), positions.data(), normals.data());
+						const M3x4& skinWorld = bindPose.GetWorld(item.nodeIndex);
+						for (unsigned int v = 0; v < mesh->vertexNum; v++) {
+							WriteTexel(positionTexels + v * 4, skinWorld * positions[v], 1.0f);
+							WriteTexel(normalTexels + v * 4, Normalize(skinWorld.TransformNormal(normals[v])), 0.0f);
+						}
+					}
+					else {
+						const M3x4& world = pose.GetWorld(item.nodeIndex);
+						for (unsigned int v = 0; v < mesh->vertexNum; v++) {
+							WriteTexel(positionTexels + v * 4, world * mesh->vertices[v].position, 1.0f);
+							WriteTexel(normalTexels + v * 4, Normalize(world.TransformNormal(mesh->vertices[v].normal)), 0.0f);
+						}
+					}
+				}
+			}
+		}
+
+		if (stats) {
+			stats->bakeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			stats->atlasBytes = atlasBytes;
+			stats->fileBytes = sizeof(MGObject) + mgo.size;
+		}
+		return mgo;
+	}
+
+	// wb_[̌ɃNbvAACeAi16oCgEjeNZ
+	BAKED_ANIMATION* GetBakedAnimationByMGObject(const MGObject& mgo)
+	{
+		char* current = mgo.data;
+
+		BAKED_ANIMATION* baked = (BAKED_ANIMATION*)current;
+		current += sizeof(BAKED_ANIMATION);
+
+		baked->clips = (BAKED_CLIP*)current;
+		current += sizeof(BAKED_CLIP) * baked->clipNum;
+
+		baked->items = (BAKED_ITEM*)current;
+		current += sizeof(BAKED_ITEM) * baked->itemNum;
+
+		size_t texelOffset = (size_t)(current - mgo.data);
+		texelOffset = (texelOffset + BAKED_TEXEL_ALIGN - 1) / BAKED_TEXEL_ALIGN * BAKED_TEXEL_ALIGN;
+		baked->texels = (float*)(mgo.data + texelOffset);
+		return baked;
+	}
+
+
+	// =======================================================
+	// Đ
+	// =======================================================
+	const float* GetBakedRow(const BAKED_ANIMATION* baked, unsigned int clip, unsigned int sample)
+	{
+		return baked->texels + (size_t)(baked->clips[clip].firstRow + sample) * baked->width * 4;
+	}
+
+	// [v̎̓Nbv̒iframes / frameRatej
+	// Ō̍sNbv̏I܂ł̒[̊ԂAŌ̍sƍŏ̍sԂ
+	void GetBakedSamples(const BAKED_ANIMATION* baked, unsigned int clip, float time, bool loop, unsigned int& sample0, unsigned int& sample1, float& t)
+	{
+		const BAKED_CLIP& bakedClip = baked->clips[clip];
+		unsigned int rowNum = bakedClip.rowNum;
+		float lastPosition = (float)(rowNum - 1);
+		time = std::max(time, 0.0f);
+		if (loop && bakedClip.frameRate > 0.0f && bakedClip.frames > 0.0f) {
+			time = fmodf(time, bakedClip.frames / bakedClip.frameRate);
+		}
+		float position = std::min(time * baked->sampleRate, loop ? FLT_MAX : lastPosition);
+		if (position >= lastPosition) {
+			float endPosition = (bakedClip.frameRate > 0.0f) ? bakedClip.frames / bakedClip.frameRate * baked->sampleRate : 0.0f;
+			sample0 = rowNum - 1;
+			sample1 = loop ? 0 : sample0;
+			t = (loop && endPosition > lastPosition) ? std::min((position - lastPosition) / (endPosition - lastPosition), 1.0f) : 0.0f;
+			return;
+		}
+		sample0 = (unsigned int)position;
+		sample1 = sample0 + 1;
+		t = position - (float)sample0;
+	}
+
+	// s̗vfƂ̐`ԁiTvԊuZOj
+	void LoadBakedNodeWorldTransforms(const BAKED_ANIMATION* baked, unsigned int clip, float time, bool loop, const M4x4& worldTransform, Pose& pose)
+	{
+		if (baked->mode != BAKE_MODE_NODE_MATRIX) {
+			return;
+		}
+		unsigned int sample0, sample1;
+		float t;
+		GetBakedSamples(baked, clip, time, loop, sample0, sample1, t);
+		const M3x4* row0 = (const M3x4*)GetBakedRow(baked, clip, sample0);
+		const M3x4* row1 = (const M3x4*)GetBakedRow(baked, clip, sample1);
+
+		pose.Resize(baked->nodeNum);
+		M3x4* worlds = pose.GetWorlds();
+		M3x4 rootWorld = M3x4::FromM4x4(worldTransform);
+		for (unsigned int i = 0; i < baked->nodeNum; i++) {
+			M3x4 world;
+			const float* src0 = &row0[i]._v00;
+			const float* src1 = &row1[i]._v00;
+			float* dest = &world._v00;
+			for (int e = 0; e < 12; e++) {
+				dest[e] = src0[e] + (src1[e] - src0[e]) * t;
+			}
+			worlds[i] = world * rootWorld;
+		}
+	}
+
+} // namespace MG
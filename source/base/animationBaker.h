@@ -0,0 +1,83 @@
+// =======================================================
+// animationBaker.h
+//
+// Aj[ṼxCNiQO̔wiLN^[pj
+// fƃAj[Ṽ[gŃTvOāA
+// 1Tv1sfloat4̕\iAgXjɏo
+// EBAKE_MODE_NODE_MATRIXFm[h̃[hsiM3x4A3eNZjm[hԍ
+//   Đ̓TvOƃ[hšvZȂiLoadBakedNodeWorldTransformsj
+// EBAKE_MODE_VERTEXF`悷im[hAbVjƂ̕ό`̒_
+//   s[ʒuiw=1j~ vertexNum][@iw=0j~ vertexNum]AXLbVCPUXLjOς
+// ǂfԁi[g̃[hs͒Pʍsj
+//
+// ʂMGOBJECT_TYPE_DATAMGObjectȂ̂ŁASaveMGO/LoadMGOł̂܂ܕۑAǂݍ݂ł
+// DirectXgȂ̂ŁALinuxȂǂłR}hCœ
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _ANIMATION_BAKER_H
+#define _ANIMATION_BAKER_H
+
+#include "skinning.h"
+#include "MGObject.h"
+
+namespace MG {
+
+	enum BAKE_MODE {
+		BAKE_MODE_NODE_MATRIX,
+		BAKE_MODE_VERTEX
+	};
+
+	static constexpr unsigned int BAKED_CLIP_NAME_MAX = 64;
+
+	// Nbv̍s
+	struct BAKED_CLIP {
+		char name[BAKED_CLIP_NAME_MAX];
+		unsigned int firstRow;
+		unsigned int rowNum;
+		float frames;			// ̃Aj[Ṽt[
+		float frameRate;		// ̃Aj[Ṽt[[g
+	};
+
+	// BAKE_MODE_VERTEXŁA`悷im[hAbVj̒_̈ʒu
+	struct BAKED_ITEM {
+		unsigned int nodeIndex;
+		unsigned int meshIndex;
+		unsigned int firstVertex;
+		unsigned int vertexNum;
+	};
+
+	// AgX{́AGetBakedAnimationByMGObjectœǂݍ
+	struct BAKED_ANIMATION {
+		BAKE_MODE mode;
+		unsigned int width;			// s̃eNZifloat4j
+		unsigned int height;		// siSNbṽTv̍vj
+		unsigned int nodeNum;
+		unsigned int vertexNum;		// BAKE_MODE_VERTEX̂
+		float sampleRate;			// 1b̃Tv
+		unsigned int clipNum;
+		unsigned int itemNum;
+		BAKED_CLIP* clips;
+		BAKED_ITEM* items;
+		float* texels;				// width * height * 4
+	};
+
+	struct BAKE_STATS {
+		double bakeMilliseconds;
+		size_t atlasBytes;			// eNZ
+		size_t fileBytes;			// MGObject̃f[^S
+	};
+
+	// animations̏ɃNbvɂAsampleRate1b̃Tv
+	MGObject BakeAnimations(const Model* model, const std::vector<const Animation*>& animations, BAKE_MODE mode, float sampleRate, BAKE_STATS* stats = nullptr);
+	BAKED_ANIMATION* GetBakedAnimationByMGObject(const MGObject& mgo);
+
+	// ĐFclip̎ԁibj̍soAO̍s̊Ԃ͕
+	// loopȂNbv̒Ő܂ԂAŌ̍s͍̎ŏ̍s
+	const float* GetBakedRow(const BAKED_ANIMATION* baked, unsigned int clip, unsigned int sample);
+	void GetBakedSamples(const BAKED_ANIMATION* baked, unsigned int clip, float time, bool loop, unsigned int& sample0, unsigned int& sample1, float& t);
+	void LoadBakedNodeWorldTransforms(const BAKED_ANIMATION* baked, unsigned int clip, float time, bool loop, const M4x4& worldTransform, Pose& pose);
+
+} // namespace MG
+
+#endif
@@ -0,0 +1,175 @@
+// =======================================================
+// animationEvent.cpp
+//
+// Aj[ṼCxggbN
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "animationEvent.h"
+#include "CSVResource.h"
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+
+namespace MG {
+
+	// =======================================================
+	// ǂݍ
+	// L[sԂ̂D_KVTABLEɂ͂Awb_[T
+	// =======================================================
+	static int FindColumn(const D_ROW& header, const char* name)
+	{
+		for (size_t i = 0; i < header.size(); i++) {
+			std::string column = header[i];
+			// 擪BOM
+			if (i == 0 && column.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+				column = column.substr(3);
+			}
+			if (column == name) {
+				return (int)i;
+			}
+		}
+		return -1;
+	}
+
+	// t[̗lƂēǂ߂ȂfalseiO͓Ȃj
+	static bool ParseFrame(const std::string& text, float& frame)
+	{
+		const char* begin = text.c_str();
+		char* end = nullptr;
+		frame = strtof(begin, &end);
+		while (*end == ' ' || *end == '\t' || *end == '\r') {
+			end++;
+		}
+		return end != begin && *end == '\0' && isfinite(frame);
+	}
+
+	bool AnimationEventTrack::Load(const std::string& path)
+	{
+		D_TABLE table;
+		ReadCSVFromPath(path, table);
+		if (table.empty()) {
+			return false;
+		}
+		int frameColumn = FindColumn(table[0], "frame");
+		int nameColumn = FindColumn(table[0], "name");
+		if (frameColumn < 0 || nameColumn < 0) {
+			return false;
+		}
+
+		std::vector<ANIMATION_EVENT> loaded;
+		loaded.reserve(table.size() - 1);
+		for (size_t y = 1; y < table.size(); y++) {
+			const D_ROW& row = table[y];
+			if ((int)row.size() <= std::max(frameColumn, nameColumn) || row[frameColumn].empty()) {
+				continue;
+			}
+			float frame;
+			if (!ParseFrame(row[frameColumn], frame)) {
+				continue;
+			}
+			loaded.push_back({ frame, row[nameColumn] });
+		}
+		SetEvents(loaded);
+		return true;
+	}
+
+	void AnimationEventTrack::SetEvents(const std::vector<ANIMATION_EVENT>& events)
+	{
+		this->events = events;
+		std::stable_sort(this->events.begin(), this->events.end(), [](const ANIMATION_EVENT& a, const ANIMATION_EVENT& b) {
+			return a.frame < b.frame;
+		});
+	}
+
+	unsigned int AnimationEventTrack::GetEventNum() const
+	{
+		return (unsigned int)events.size();
+	}
+
+	const ANIMATION_EVENT& AnimationEventTrack::GetEvent(unsigned int index) const
+	{
+		return events[index];
+	}
+
+
+	// =======================================================
+	// frameȏ̍ŏ̃Cxgi񕪒Tj
+	// =======================================================
+	unsigned int AnimationEventTrack::LowerBound(float frame) const
+	{
+		return (unsigned int)(std::lower_bound(events.begin(), events.end(), frame, [](const ANIMATION_EVENT& event, float frame) {
+			return event.frame < frame;
+		}) - events.begin());
+	}
+
+
+	// =======================================================
+	// ʉ߂Cxg
+	// [v̏I[ɓ͂I[̃Cxg܂Ŋ܂߂āAc͐擪
+	// =======================================================
+	unsigned int AnimationEventTrack::Query(float frame0, float frame1, float frames, bool loop, ANIMATION_EVENT_RANGE ranges[ANIMATION_EVENT_RANGE_MAX]) const
+	{
+		if (events.empty()) {
+			return 0;
+		}
+		const unsigned int eventNum = (unsigned int)events.size();
+
+		if (!loop || frames <= 0.0f) {
+			frame0 = std::max(frame0, 0.0f);
+			frame1 = std::min(frame1, frames);
+			if (frame1 <= frame0) {
+				return 0;
+			}
+			unsigned int first = LowerBound(frame0);
+			unsigned int last = (frame1 >= frames) ? eventNum : LowerBound(frame1);
+			ranges[0] = { first, last - first };
+			return (last > first) ? 1 : 0;
+		}
+
+		if (frame1 < frame0) {
+			frame1 += frames;
+		}
+		if (frame1 - frame0 >= frames) {
+			ranges[0] = { 0, eventNum };
+			return 1;
+		}
+		float start = fmodf(frame0, frames);
+		if (start < 0.0f) {
+			start += frames;
+		}
+		float end = start + (frame1 - frame0);
+
+		unsigned int rangeNum = 0;
+		unsigned int first = LowerBound(start);
+		if (end < frames) {
+			unsigned int last = LowerBound(end);
+			if (last > first) {
+				ranges[rangeNum++] = { first, last - first };
+			}
+			return rangeNum;
+		}
+
+		// I[܂
+		if (eventNum > first) {
+			ranges[rangeNum++] = { first, eventNum - first };
+		}
+		unsigned int last = std::min(LowerBound(end - frames), first);
+		if (last > 0) {
+			ranges[rangeNum++] = { 0, last };
+		}
+		return rangeNum;
+	}
+
+
+	std::string GetAnimationEventPath(const std::string& animationPath)
+	{
+		size_t dot = animationPath.find_last_of('.');
+		size_t separator = animationPath.find_last_of("\\/");
+		if (dot == std::string::npos || (separator != std::string::npos && dot < separator)) {
+			return animationPath + "_event.csv";
+		}
+		return animationPath.substr(0, dot) + "_event.csv";
+	}
+
+} // namespace MG
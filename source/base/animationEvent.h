@@ -0,0 +1,58 @@
+// =======================================================
+// animationEvent.h
+//
+// Aj[ṼCxggbN
+// U̓AȂǂt[ԍŎA
+// ut[ab܂łɒʉ߂Cxgv񕪒Tň
+// ǂݍݎɃt[ɕׂĂA₢킹ł̓mۂȂ
+//
+// CSViNbvƓOŁu_event.csvvAȂ΃CxgȂj̗Fframe,name
+//   frame͏At[̕CxgCSV̏
+//   framelƂēǂ߂Ȃs͔΂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _ANIMATION_EVENT_H
+#define _ANIMATION_EVENT_H
+
+#include <string>
+#include <vector>
+
+namespace MG {
+
+	struct ANIMATION_EVENT {
+		float frame;
+		std::string name;
+	};
+
+	// ʉ߂Cxg͈̔́iGetEvent̔ԍfirstnumj
+	struct ANIMATION_EVENT_RANGE {
+		unsigned int first = 0;
+		unsigned int num = 0;
+	};
+
+	// [v̏I[܂Ɠɕ
+	static constexpr unsigned int ANIMATION_EVENT_RANGE_MAX = 2;
+
+	class AnimationEventTrack {
+	private:
+		std::vector<ANIMATION_EVENT> events;	// t[
+		unsigned int LowerBound(float frame) const;
+	public:
+		bool Load(const std::string& path);
+		void SetEvents(const std::vector<ANIMATION_EVENT>& events);
+		unsigned int GetEventNum() const;
+		const ANIMATION_EVENT& GetEvent(unsigned int index) const;
+
+		// frame0frame1܂Ői񂾂Ƃɒʉ߂Cxgi[frame0, frame1)A
+		// [vȂȂI[frameŝ̂܂ށjA͈͂̐Ԃ
+		// [vȂframe1 < frame0͈Aȏi񂾂S
+		unsigned int Query(float frame0, float frame1, float frames, bool loop, ANIMATION_EVENT_RANGE ranges[ANIMATION_EVENT_RANGE_MAX]) const;
+	};
+
+	// NbṽpXCxgCSṼpXigqu_event.csvvɁj
+	std::string GetAnimationEventPath(const std::string& animationPath);
+
+} // namespace MG
+
+#endif
@@ -0,0 +1,537 @@
+// =======================================================
+// animationKernel.cpp
+//
+// ԂSIMDob`
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "animationKernel.h"
+#include "MGCommon.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define ANIMATION_KERNEL_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ANIMATION_KERNEL_TARGET_AVX2
+#else
+#define ANIMATION_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace MG {
+
+	// =======================================================
+	// CPŮmF
+	// AVX2CPUOSiYMMWX^̕ۑj̗ΉĂ邱
+	// =======================================================
+	static ANIMATION_KERNEL CheckSupportedKernel()
+	{
+#ifdef ANIMATION_KERNEL_X86
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+		__cpuid(info, 1);
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		bool avx2 = false;
+		if (maxLeaf >= 7) {
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+		if (osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6) {
+			return ANIMATION_KERNEL_AVX2;
+		}
+#else
+		if (__builtin_cpu_supports("avx2")) {
+			return ANIMATION_KERNEL_AVX2;
+		}
+#endif
+		return ANIMATION_KERNEL_SSE;	// x86/x64ȂSSE2͕K
+#else
+		return ANIMATION_KERNEL_SCALAR;
+#endif
+	}
+
+	static const ANIMATION_KERNEL g_supportedKernel = CheckSupportedKernel();
+	static ANIMATION_KERNEL g_kernel = g_supportedKernel;
+
+	ANIMATION_KERNEL GetSupportedAnimationKernel()
+	{
+		return g_supportedKernel;
+	}
+
+	ANIMATION_KERNEL GetAnimationKernel()
+	{
+		return g_kernel;
+	}
+
+	void SetAnimationKernel(ANIMATION_KERNEL kernel)
+	{
+		g_kernel = (kernel > g_supportedKernel) ? g_supportedKernel : kernel;
+	}
+
+
+	// =======================================================
+	// XJ[Łi[ƃtH[obNpj
+	// MGCommon̊֐̂܂܎ĝŁAʂ͈Έ̌ĂяoƓ
+	// =======================================================
+	static void LerpScalar(const F3_SOA& v0, const F3_SOA& v1, const float* t, const F3_SOA& out, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++) {
+			F3 v = Lerp(F3{ v0.x[i], v0.y[i], v0.z[i] }, F3{ v1.x[i], v1.y[i], v1.z[i] }, t[i]);
+			out.x[i] = v.x;
+			out.y[i] = v.y;
+			out.z[i] = v.z;
+		}
+	}
+
+	static void NlerpScalar(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++) {
+			Quaternion q = Nlerp(Quaternion{ q0.x[i], q0.y[i], q0.z[i], q0.w[i] }, Quaternion{ q1.x[i], q1.y[i], q1.z[i], q1.w[i] }, t[i]);
+			out.x[i] = q.x;
+			out.y[i] = q.y;
+			out.z[i] = q.z;
+			out.w[i] = q.w;
+		}
+	}
+
+	static void SlerpScalar(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++) {
+			Quaternion q = Slerp(Quaternion{ q0.x[i], q0.y[i], q0.z[i], q0.w[i] }, Quaternion{ q1.x[i], q1.y[i], q1.z[i], q1.w[i] }, t[i]);
+			out.x[i] = q.x;
+			out.y[i] = q.y;
+			out.z[i] = q.z;
+			out.w[i] = q.w;
+		}
+	}
+
+	static void FastSlerpScalar(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++) {
+			Quaternion q = FastSlerp(Quaternion{ q0.x[i], q0.y[i], q0.z[i], q0.w[i] }, Quaternion{ q1.x[i], q1.y[i], q1.z[i], q1.w[i] }, t[i]);
+			out.x[i] = q.x;
+			out.y[i] = q.y;
+			out.z[i] = q.z;
+			out.w[i] = q.w;
+		}
+	}
+
+#ifdef ANIMATION_KERNEL_X86
+
+	// ߎ̌W
+	// acos(x) = sqrt(1 - x) *  a_n x^ni0 <= x <= 1A덷2e-8j
+	static constexpr float ACOS_A0 = 1.5707963050f;
+	static constexpr float ACOS_A1 = -0.2145988016f;
+	static constexpr float ACOS_A2 = 0.0889789874f;
+	static constexpr float ACOS_A3 = -0.0501743046f;
+	static constexpr float ACOS_A4 = 0.0308918810f;
+	static constexpr float ACOS_A5 = -0.0170881256f;
+	static constexpr float ACOS_A6 = 0.0066700901f;
+	static constexpr float ACOS_A7 = -0.0012624911f;
+	// sin(x)̃eC[WJi0 <= x <= /2A덷6e-8j
+	static constexpr float SIN_C3 = -1.0f / 6.0f;
+	static constexpr float SIN_C5 = 1.0f / 120.0f;
+	static constexpr float SIN_C7 = -1.0f / 5040.0f;
+	static constexpr float SIN_C9 = 1.0f / 362880.0f;
+	static constexpr float SIN_C11 = -1.0f / 39916800.0f;
+
+
+	// =======================================================
+	// SSEi4j
+	// =======================================================
+	static inline __m128 Lerp4(__m128 a, __m128 b, __m128 s, __m128 t)
+	{
+		return _mm_add_ps(_mm_mul_ps(a, s), _mm_mul_ps(b, t));
+	}
+
+	// t̋ߎɃj[g@񂩂Đxグ
+	static inline __m128 InvSqrt4(__m128 x)
+	{
+		__m128 y = _mm_rsqrt_ps(x);
+		__m128 xyy = _mm_mul_ps(_mm_mul_ps(x, y), y);
+		return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), xyy));
+	}
+
+	static inline __m128 Acos4(__m128 x)
+	{
+		__m128 p = _mm_set1_ps(ACOS_A7);
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A6));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A5));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A4));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A3));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A2));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A1));
+		p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(ACOS_A0));
+		return _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)), p);
+	}
+
+	static inline __m128 Sin4(__m128 x)
+	{
+		__m128 x2 = _mm_mul_ps(x, x);
+		__m128 p = _mm_set1_ps(SIN_C11);
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(SIN_C9));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(SIN_C7));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(SIN_C5));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(SIN_C3));
+		p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+		return _mm_mul_ps(p, x);
+	}
+
+	static void LerpSSE(const F3_SOA& v0, const F3_SOA& v1, const float* t, const F3_SOA& out, size_t num)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		for (size_t i = 0; i + 4 <= num; i += 4) {
+			__m128 tt = _mm_loadu_ps(t + i);
+			__m128 s = _mm_sub_ps(one, tt);
+			_mm_storeu_ps(out.x + i, Lerp4(_mm_loadu_ps(v0.x + i), _mm_loadu_ps(v1.x + i), s, tt));
+			_mm_storeu_ps(out.y + i, Lerp4(_mm_loadu_ps(v0.y + i), _mm_loadu_ps(v1.y + i), s, tt));
+			_mm_storeu_ps(out.z + i, Lerp4(_mm_loadu_ps(v0.z + i), _mm_loadu_ps(v1.z + i), s, tt));
+		}
+		LerpScalar(v0, v1, t, out, num & ~(size_t)3, num);
+	}
+
+	// ςȂq1̌W̕𔽓]čŒZoH
+	static void NlerpSSE(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 signMask = _mm_set1_ps(-0.0f);
+		for (size_t i = 0; i + 4 <= num; i += 4) {
+			__m128 tt = _mm_loadu_ps(t + i);
+			__m128 s = _mm_sub_ps(one, tt);
+			__m128 ax = _mm_loadu_ps(q0.x + i), ay = _mm_loadu_ps(q0.y + i), az = _mm_loadu_ps(q0.z + i), aw = _mm_loadu_ps(q0.w + i);
+			__m128 bx = _mm_loadu_ps(q1.x + i), by = _mm_loadu_ps(q1.y + i), bz = _mm_loadu_ps(q1.z + i), bw = _mm_loadu_ps(q1.w + i);
+			__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			tt = _mm_xor_ps(tt, _mm_and_ps(d, signMask));
+			__m128 x = Lerp4(ax, bx, s, tt);
+			__m128 y = Lerp4(ay, by, s, tt);
+			__m128 z = Lerp4(az, bz, s, tt);
+			__m128 w = Lerp4(aw, bw, s, tt);
+			__m128 length2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+			__m128 inv = InvSqrt4(length2);
+			_mm_storeu_ps(out.x + i, _mm_mul_ps(x, inv));
+			_mm_storeu_ps(out.y + i, _mm_mul_ps(y, inv));
+			_mm_storeu_ps(out.z + i, _mm_mul_ps(z, inv));
+			_mm_storeu_ps(out.w + i, _mm_mul_ps(w, inv));
+		}
+		NlerpScalar(q0, q1, t, out, num & ~(size_t)3, num);
+	}
+
+	// ςȂŒZoHɂȂ悤q1𔽓]Aق1Ȃnlerp̌ʂg
+	static void SlerpSSE(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 signMask = _mm_set1_ps(-0.0f);
+		__m128 nearOne = _mm_set1_ps(1.0f - EPSILON);
+		for (size_t i = 0; i + 4 <= num; i += 4) {
+			__m128 tt = _mm_loadu_ps(t + i);
+			__m128 s = _mm_sub_ps(one, tt);
+			__m128 ax = _mm_loadu_ps(q0.x + i), ay = _mm_loadu_ps(q0.y + i), az = _mm_loadu_ps(q0.z + i), aw = _mm_loadu_ps(q0.w + i);
+			__m128 bx = _mm_loadu_ps(q1.x + i), by = _mm_loadu_ps(q1.y + i), bz = _mm_loadu_ps(q1.z + i), bw = _mm_loadu_ps(q1.w + i);
+			__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			__m128 sign = _mm_and_ps(d, signMask);
+			d = _mm_xor_ps(d, sign);
+			bx = _mm_xor_ps(bx, sign);
+			by = _mm_xor_ps(by, sign);
+			bz = _mm_xor_ps(bz, sign);
+			bw = _mm_xor_ps(bw, sign);
+
+			// nlerp
+			__m128 lx = Lerp4(ax, bx, s, tt), ly = Lerp4(ay, by, s, tt), lz = Lerp4(az, bz, s, tt), lw = Lerp4(aw, bw, s, tt);
+			__m128 inv = InvSqrt4(_mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, lx), _mm_mul_ps(ly, ly)), _mm_add_ps(_mm_mul_ps(lz, lz), _mm_mul_ps(lw, lw))));
+			lx = _mm_mul_ps(lx, inv);
+			ly = _mm_mul_ps(ly, inv);
+			lz = _mm_mul_ps(lz, inv);
+			lw = _mm_mul_ps(lw, inv);
+
+			// slerp
+			__m128 theta = Acos4(d);
+			__m128 invSinTheta = _mm_div_ps(one, _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(d, d))));
+			__m128 w0 = _mm_mul_ps(Sin4(_mm_mul_ps(s, theta)), invSinTheta);
+			__m128 w1 = _mm_mul_ps(Sin4(_mm_mul_ps(tt, theta)), invSinTheta);
+
+			__m128 near = _mm_cmpgt_ps(d, nearOne);
+			_mm_storeu_ps(out.x + i, _mm_or_ps(_mm_and_ps(near, lx), _mm_andnot_ps(near, Lerp4(ax, bx, w0, w1))));
+			_mm_storeu_ps(out.y + i, _mm_or_ps(_mm_and_ps(near, ly), _mm_andnot_ps(near, Lerp4(ay, by, w0, w1))));
+			_mm_storeu_ps(out.z + i, _mm_or_ps(_mm_and_ps(near, lz), _mm_andnot_ps(near, Lerp4(az, bz, w0, w1))));
+			_mm_storeu_ps(out.w + i, _mm_or_ps(_mm_and_ps(near, lw), _mm_andnot_ps(near, Lerp4(aw, bw, w0, w1))));
+		}
+		SlerpScalar(q0, q1, t, out, num & ~(size_t)3, num);
+	}
+
+	// MG::FastSlerpƓAW̓[v̊Oœǂݍ
+	static void FastSlerpSSE(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		const FAST_SLERP_COEFFICIENT& coefficient = GetFastSlerpCoefficient();
+		__m128 u[FAST_SLERP_TERM];
+		__m128 v[FAST_SLERP_TERM];
+		for (int n = 0; n < FAST_SLERP_TERM; n++) {
+			u[n] = _mm_set1_ps(coefficient.u[n]);
+			v[n] = _mm_set1_ps(coefficient.v[n]);
+		}
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 signMask = _mm_set1_ps(-0.0f);
+		for (size_t i = 0; i + 4 <= num; i += 4) {
+			__m128 tt = _mm_loadu_ps(t + i);
+			__m128 s = _mm_sub_ps(one, tt);
+			__m128 ax = _mm_loadu_ps(q0.x + i), ay = _mm_loadu_ps(q0.y + i), az = _mm_loadu_ps(q0.z + i), aw = _mm_loadu_ps(q0.w + i);
+			__m128 bx = _mm_loadu_ps(q1.x + i), by = _mm_loadu_ps(q1.y + i), bz = _mm_loadu_ps(q1.z + i), bw = _mm_loadu_ps(q1.w + i);
+			__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			__m128 sign = _mm_and_ps(d, signMask);
+			__m128 xm1 = _mm_sub_ps(_mm_xor_ps(d, sign), one);
+
+			__m128 s2 = _mm_mul_ps(s, s);
+			__m128 t2 = _mm_mul_ps(tt, tt);
+			__m128 c0 = one;
+			__m128 c1 = one;
+			for (int n = FAST_SLERP_TERM - 1; n >= 0; n--) {
+				c0 = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u[n], s2), v[n]), xm1), c0));
+				c1 = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u[n], t2), v[n]), xm1), c1));
+			}
+			c0 = _mm_mul_ps(c0, s);
+			c1 = _mm_xor_ps(_mm_mul_ps(c1, tt), sign);
+
+			_mm_storeu_ps(out.x + i, Lerp4(ax, bx, c0, c1));
+			_mm_storeu_ps(out.y + i, Lerp4(ay, by, c0, c1));
+			_mm_storeu_ps(out.z + i, Lerp4(az, bz, c0, c1));
+			_mm_storeu_ps(out.w + i, Lerp4(aw, bw, c0, c1));
+		}
+		FastSlerpScalar(q0, q1, t, out, num & ~(size_t)3, num);
+	}
+
+
+	// =======================================================
+	// AVX2i8j
+	// gSSEłƓ
+	// =======================================================
+	ANIMATION_KERNEL_TARGET_AVX2 static inline __m256 Lerp8(__m256 a, __m256 b, __m256 s, __m256 t)
+	{
+		return _mm256_add_ps(_mm256_mul_ps(a, s), _mm256_mul_ps(b, t));
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static inline __m256 InvSqrt8(__m256 x)
+	{
+		__m256 y = _mm256_rsqrt_ps(x);
+		__m256 xyy = _mm256_mul_ps(_mm256_mul_ps(x, y), y);
+		return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), xyy));
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static inline __m256 Acos8(__m256 x)
+	{
+		__m256 p = _mm256_set1_ps(ACOS_A7);
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A6));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A5));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A4));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A3));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A2));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A1));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(ACOS_A0));
+		return _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), x)), p);
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static inline __m256 Sin8(__m256 x)
+	{
+		__m256 x2 = _mm256_mul_ps(x, x);
+		__m256 p = _mm256_set1_ps(SIN_C11);
+		p = _mm256_add_ps(_mm256_mul_ps(p, x2), _mm256_set1_ps(SIN_C9));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x2), _mm256_set1_ps(SIN_C7));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x2), _mm256_set1_ps(SIN_C5));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x2), _mm256_set1_ps(SIN_C3));
+		p = _mm256_add_ps(_mm256_mul_ps(p, x2), _mm256_set1_ps(1.0f));
+		return _mm256_mul_ps(p, x);
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static void LerpAVX2(const F3_SOA& v0, const F3_SOA& v1, const float* t, const F3_SOA& out, size_t num)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		for (size_t i = 0; i + 8 <= num; i += 8) {
+			__m256 tt = _mm256_loadu_ps(t + i);
+			__m256 s = _mm256_sub_ps(one, tt);
+			_mm256_storeu_ps(out.x + i, Lerp8(_mm256_loadu_ps(v0.x + i), _mm256_loadu_ps(v1.x + i), s, tt));
+			_mm256_storeu_ps(out.y + i, Lerp8(_mm256_loadu_ps(v0.y + i), _mm256_loadu_ps(v1.y + i), s, tt));
+			_mm256_storeu_ps(out.z + i, Lerp8(_mm256_loadu_ps(v0.z + i), _mm256_loadu_ps(v1.z + i), s, tt));
+		}
+		LerpScalar(v0, v1, t, out, num & ~(size_t)7, num);
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static void NlerpAVX2(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 signMask = _mm256_set1_ps(-0.0f);
+		for (size_t i = 0; i + 8 <= num; i += 8) {
+			__m256 tt = _mm256_loadu_ps(t + i);
+			__m256 s = _mm256_sub_ps(one, tt);
+			__m256 ax = _mm256_loadu_ps(q0.x + i), ay = _mm256_loadu_ps(q0.y + i), az = _mm256_loadu_ps(q0.z + i), aw = _mm256_loadu_ps(q0.w + i);
+			__m256 bx = _mm256_loadu_ps(q1.x + i), by = _mm256_loadu_ps(q1.y + i), bz = _mm256_loadu_ps(q1.z + i), bw = _mm256_loadu_ps(q1.w + i);
+			__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_add_ps(_mm256_mul_ps(az, bz), _mm256_mul_ps(aw, bw)));
+			tt = _mm256_xor_ps(tt, _mm256_and_ps(d, signMask));
+			__m256 x = Lerp8(ax, bx, s, tt);
+			__m256 y = Lerp8(ay, by, s, tt);
+			__m256 z = Lerp8(az, bz, s, tt);
+			__m256 w = Lerp8(aw, bw, s, tt);
+			__m256 length2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_add_ps(_mm256_mul_ps(z, z), _mm256_mul_ps(w, w)));
+			__m256 inv = InvSqrt8(length2);
+			_mm256_storeu_ps(out.x + i, _mm256_mul_ps(x, inv));
+			_mm256_storeu_ps(out.y + i, _mm256_mul_ps(y, inv));
+			_mm256_storeu_ps(out.z + i, _mm256_mul_ps(z, inv));
+			_mm256_storeu_ps(out.w + i, _mm256_mul_ps(w, inv));
+		}
+		NlerpScalar(q0, q1, t, out, num & ~(size_t)7, num);
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static void SlerpAVX2(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 signMask = _mm256_set1_ps(-0.0f);
+		__m256 nearOne = _mm256_set1_ps(1.0f - EPSILON);
+		for (size_t i = 0; i + 8 <= num; i += 8) {
+			__m256 tt = _mm256_loadu_ps(t + i);
+			__m256 s = _mm256_sub_ps(one, tt);
+			__m256 ax = _mm256_loadu_ps(q0.x + i), ay = _mm256_loadu_ps(q0.y + i), az = _mm256_loadu_ps(q0.z + i), aw = _mm256_loadu_ps(q0.w + i);
+			__m256 bx = _mm256_loadu_ps(q1.x + i), by = _mm256_loadu_ps(q1.y + i), bz = _mm256_loadu_ps(q1.z + i), bw = _mm256_loadu_ps(q1.w + i);
+			__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_add_ps(_mm256_mul_ps(az, bz), _mm256_mul_ps(aw, bw)));
+			__m256 sign = _mm256_and_ps(d, signMask);
+			d = _mm256_xor_ps(d, sign);
+			bx = _mm256_xor_ps(bx, sign);
+			by = _mm256_xor_ps(by, sign);
+			bz = _mm256_xor_ps(bz, sign);
+			bw = _mm256_xor_ps(bw, sign);
+
+			__m256 lx = Lerp8(ax, bx, s, tt), ly = Lerp8(ay, by, s, tt), lz = Lerp8(az, bz, s, tt), lw = Lerp8(aw, bw, s, tt);
+			__m256 inv = InvSqrt8(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lx, lx), _mm256_mul_ps(ly, ly)), _mm256_add_ps(_mm256_mul_ps(lz, lz), _mm256_mul_ps(lw, lw))));
+			lx = _mm256_mul_ps(lx, inv);
+			ly = _mm256_mul_ps(ly, inv);
+			lz = _mm256_mul_ps(lz, inv);
+			lw = _mm256_mul_ps(lw, inv);
+
+			__m256 theta = Acos8(d);
+			__m256 invSinTheta = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_sub_ps(one, _mm256_mul_ps(d, d))));
+			__m256 w0 = _mm256_mul_ps(Sin8(_mm256_mul_ps(s, theta)), invSinTheta);
+			__m256 w1 = _mm256_mul_ps(Sin8(_mm256_mul_ps(tt, theta)), invSinTheta);
+
+			__m256 near = _mm256_cmp_ps(d, nearOne, _CMP_GT_OQ);
+			_mm256_storeu_ps(out.x + i, _mm256_blendv_ps(Lerp8(ax, bx, w0, w1), lx, near));
+			_mm256_storeu_ps(out.y + i, _mm256_blendv_ps(Lerp8(ay, by, w0, w1), ly, near));
+			_mm256_storeu_ps(out.z + i, _mm256_blendv_ps(Lerp8(az, bz, w0, w1), lz, near));
+			_mm256_storeu_ps(out.w + i, _mm256_blendv_ps(Lerp8(aw, bw, w0, w1), lw, near));
+		}
+		SlerpScalar(q0, q1, t, out, num & ~(size_t)7, num);
+	}
+
+	ANIMATION_KERNEL_TARGET_AVX2 static void FastSlerpAVX2(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		const FAST_SLERP_COEFFICIENT& coefficient = GetFastSlerpCoefficient();
+		__m256 u[FAST_SLERP_TERM];
+		__m256 v[FAST_SLERP_TERM];
+		for (int n = 0; n < FAST_SLERP_TERM; n++) {
+			u[n] = _mm256_set1_ps(coefficient.u[n]);
+			v[n] = _mm256_set1_ps(coefficient.v[n]);
+		}
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 signMask = _mm256_set1_ps(-0.0f);
+		for (size_t i = 0; i + 8 <= num; i += 8) {
+			__m256 tt = _mm256_loadu_ps(t + i);
+			__m256 s = _mm256_sub_ps(one, tt);
+			__m256 ax = _mm256_loadu_ps(q0.x + i), ay = _mm256_loadu_ps(q0.y + i), az = _mm256_loadu_ps(q0.z + i), aw = _mm256_loadu_ps(q0.w + i);
+			__m256 bx = _mm256_loadu_ps(q1.x + i), by = _mm256_loadu_ps(q1.y + i), bz = _mm256_loadu_ps(q1.z + i), bw = _mm256_loadu_ps(q1.w + i);
+			__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_add_ps(_mm256_mul_ps(az, bz), _mm256_mul_ps(aw, bw)));
+			__m256 sign = _mm256_and_ps(d, signMask);
+			__m256 xm1 = _mm256_sub_ps(_mm256_xor_ps(d, sign), one);
+
+			__m256 s2 = _mm256_mul_ps(s, s);
+			__m256 t2 = _mm256_mul_ps(tt, tt);
+			__m256 c0 = one;
+			__m256 c1 = one;
+			for (int n = FAST_SLERP_TERM - 1; n >= 0; n--) {
+				c0 = _mm256_add_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(u[n], s2), v[n]), xm1), c0));
+				c1 = _mm256_add_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(u[n], t2), v[n]), xm1), c1));
+			}
+			c0 = _mm256_mul_ps(c0, s);
+			c1 = _mm256_xor_ps(_mm256_mul_ps(c1, tt), sign);
+
+			_mm256_storeu_ps(out.x + i, Lerp8(ax, bx, c0, c1));
+			_mm256_storeu_ps(out.y + i, Lerp8(ay, by, c0, c1));
+			_mm256_storeu_ps(out.z + i, Lerp8(az, bz, c0, c1));
+			_mm256_storeu_ps(out.w + i, Lerp8(aw, bw, c0, c1));
+		}
+		FastSlerpScalar(q0, q1, t, out, num & ~(size_t)7, num);
+	}
+
+#endif
+
+
+	// =======================================================
+	// U蕪
+	// =======================================================
+	void LerpBatch(const F3_SOA& v0, const F3_SOA& v1, const float* t, const F3_SOA& out, size_t num)
+	{
+		switch (g_kernel) {
+#ifdef ANIMATION_KERNEL_X86
+		case ANIMATION_KERNEL_AVX2:
+			LerpAVX2(v0, v1, t, out, num);
+			return;
+		case ANIMATION_KERNEL_SSE:
+			LerpSSE(v0, v1, t, out, num);
+			return;
+#endif
+		default:
+			LerpScalar(v0, v1, t, out, 0, num);
+			return;
+		}
+	}
+
+	void NlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		switch (g_kernel) {
+#ifdef ANIMATION_KERNEL_X86
+		case ANIMATION_KERNEL_AVX2:
+			NlerpAVX2(q0, q1, t, out, num);
+			return;
+		case ANIMATION_KERNEL_SSE:
+			NlerpSSE(q0, q1, t, out, num);
+			return;
+#endif
+		default:
+			NlerpScalar(q0, q1, t, out, 0, num);
+			return;
+		}
+	}
+
+	void SlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		switch (g_kernel) {
+#ifdef ANIMATION_KERNEL_X86
+		case ANIMATION_KERNEL_AVX2:
+			SlerpAVX2(q0, q1, t, out, num);
+			return;
+		case ANIMATION_KERNEL_SSE:
+			SlerpSSE(q0, q1, t, out, num);
+			return;
+#endif
+		default:
+			SlerpScalar(q0, q1, t, out, 0, num);
+			return;
+		}
+	}
+
+	void FastSlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num)
+	{
+		switch (g_kernel) {
+#ifdef ANIMATION_KERNEL_X86
+		case ANIMATION_KERNEL_AVX2:
+			FastSlerpAVX2(q0, q1, t, out, num);
+			return;
+		case ANIMATION_KERNEL_SSE:
+			FastSlerpSSE(q0, q1, t, out, num);
+			return;
+#endif
+		default:
+			FastSlerpScalar(q0, q1, t, out, 0, num);
+			return;
+		}
+	}
+
+} // namespace MG
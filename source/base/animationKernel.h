@@ -0,0 +1,62 @@
+// =======================================================
+// animationKernel.h
+//
+// ԂSIMDob`
+// SoAiƂ̔zjŎ󂯎ASSE4AAVX28
+// lerp / nlerp / slerp / fast slerp
+// NH[^jI͂ǂςȂq1𔽓]čŒZoHŕԂ
+// g閽߃Zbg͋NCPU𒲂ׂđIԁiȂ΃XJ[j
+//
+// XJ[ŁiMG::LerpAMG::NlerpAMG::SlerpAMG::FastSlerpjƂ̌덷i̐Βlj
+//   lerp       F1e-6ȉiZȂ̂Œʏ͈vj
+//   nlerp      F2e-6ȉit̋ߎ{j[g@j
+//   slerp      F1e-5ȉiacosAsin̑ߎj
+//   fast slerp F1e-6ȉiAZj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _ANIMATION_KERNEL_H
+#define _ANIMATION_KERNEL_H
+
+#include <stddef.h>
+
+namespace MG {
+
+	static constexpr float ANIMATION_KERNEL_LERP_EPSILON = 1e-6f;
+	static constexpr float ANIMATION_KERNEL_NLERP_EPSILON = 2e-6f;
+	static constexpr float ANIMATION_KERNEL_SLERP_EPSILON = 1e-5f;
+	static constexpr float ANIMATION_KERNEL_FAST_SLERP_EPSILON = 1e-6f;
+
+	enum ANIMATION_KERNEL {
+		ANIMATION_KERNEL_SCALAR = 0,
+		ANIMATION_KERNEL_SSE,	// 4
+		ANIMATION_KERNEL_AVX2	// 8
+	};
+
+	// Ƃ̔z
+	struct F3_SOA {
+		float* x;
+		float* y;
+		float* z;
+	};
+
+	struct QUATERNION_SOA {
+		float* x;
+		float* y;
+		float* z;
+		float* w;
+	};
+
+	ANIMATION_KERNEL GetSupportedAnimationKernel();
+	ANIMATION_KERNEL GetAnimationKernel();
+	void SetAnimationKernel(ANIMATION_KERNEL kernel);	// ΉĂȂΎg钆ňԏɂȂ
+
+	// t͗vfƂ̕ԌWAout͓͂Ɠzł
+	void LerpBatch(const F3_SOA& v0, const F3_SOA& v1, const float* t, const F3_SOA& out, size_t num);
+	void NlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num);
+	void SlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num);
+	void FastSlerpBatch(const QUATERNION_SOA& q0, const QUATERNION_SOA& q1, const float* t, const QUATERNION_SOA& out, size_t num);
+
+} // namespace MG
+
+#endif
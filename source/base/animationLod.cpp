@@ -0,0 +1,160 @@
+// =======================================================
+// animationLod.cpp
+//
+// Aj[VLODiڍדxj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "animationLod.h"
+#include "resourceTool.h"
+
+namespace MG {
+
+	AnimationLod::AnimationLod()
+	{
+		levels = {
+			{ 0.0f, 1, false },
+			{ 20.0f, 2, false },
+			{ 40.0f, 4, true },
+			{ 80.0f, 8, true }
+		};
+	}
+
+	void AnimationLod::SetLevels(const std::vector<ANIMATION_LOD_LEVEL>& levels)
+	{
+		this->levels = levels;
+		if (this->levels.empty()) {
+			this->levels.push_back({ 0.0f, 1, false });
+		}
+	}
+
+	const std::vector<ANIMATION_LOD_LEVEL>& AnimationLod::GetLevels() const
+	{
+		return levels;
+	}
+
+	void AnimationLod::SetHysteresis(float hysteresis)
+	{
+		this->hysteresis = hysteresis;
+	}
+
+	void AnimationLod::SetModelDepth(const Model* model, unsigned int depth)
+	{
+		MODEL_LOD& modelLod = models[model];
+		modelLod.depth = depth;
+		modelLod.mask = BoneMask();
+		modelLod.maskNodeNum = 0;
+	}
+
+
+	// =======================================================
+	// fƂ̃}XNi[depthȉ̃m[hj
+	// e͕KqOɂ̂ŁA擪[߂
+	// =======================================================
+	AnimationLod::MODEL_LOD& AnimationLod::GetModelLod(const Model* model)
+	{
+		MODEL_LOD& modelLod = models[model];
+		if (modelLod.mask.GetNodeNum() != model->nodeNum) {
+			std::vector<unsigned int> depths(model->nodeNum);
+			modelLod.mask = BoneMask(model->nodeNum);
+			modelLod.maskNodeNum = 0;
+			for (unsigned int i = 0; i < model->nodeNum; i++) {
+				unsigned int parent = model->parentIndexes[i];
+				depths[i] = (parent == NODE_PARENT_NONE) ? 0 : depths[parent] + 1;
+				if (depths[i] <= modelLod.depth) {
+					modelLod.mask.Set(i);
+					modelLod.maskNodeNum++;
+				}
+			}
+		}
+		return modelLod;
+	}
+
+
+	// =======================================================
+	// x̑I
+	// ߂ÂƂ͂̂܂܂̋AƂ(1 + hysteresis){̋Ő؂ւ
+	// =======================================================
+	unsigned int AnimationLod::SelectLevel(unsigned int currentLevel, float distance) const
+	{
+		unsigned int level = 0;
+		for (unsigned int i = 1; i < levels.size(); i++) {
+			float threshold = levels[i].distance;
+			if (i > currentLevel) {
+				threshold *= 1.0f + hysteresis;
+			}
+			if (distance >= threshold) {
+				level = i;
+			}
+		}
+		return level;
+	}
+
+	void AnimationLod::Plan(const F3& viewPosition, CROWD_JOB* jobs, ANIMATION_LOD_STATE* states, size_t jobNum)
+	{
+		counters = {};
+		counters.instanceNum = (unsigned int)jobNum;
+		for (size_t i = 0; i < jobNum; i++) {
+			CROWD_JOB& job = jobs[i];
+			ANIMATION_LOD_STATE& state = states[i];
+			if (!state.evaluated) {
+				state.phase = nextPhase++;
+			}
+
+			F3 offset = F3{ job.worldTransform._v03, job.worldTransform._v13, job.worldTransform._v23 } - viewPosition;
+			float distance = sqrtf(Dot(offset, offset));
+			if (state.level >= levels.size()) {
+				state.level = (unsigned int)levels.size() - 1;
+			}
+			state.level = SelectLevel(state.level, distance);
+			const ANIMATION_LOD_LEVEL& level = levels[state.level];
+			counters.levelInstanceNum[std::min<unsigned int>(state.level, 3)]++;
+
+			unsigned int nodeNum = job.model->nodeNum;
+			job.updateMask = nullptr;
+			job.coast = false;
+
+			// oCh|[Y͖񓯂Ȃ̂LODȂ
+			if (!job.animationApplicants) {
+				counters.sampledInstanceNum++;
+				counters.sampledNodeNum += nodeNum;
+				state.evaluated = true;
+				continue;
+			}
+
+			unsigned int interval = std::max(level.updateInterval, 1u);
+			if (state.evaluated && (frame + state.phase) % interval != 0) {
+				job.coast = true;
+				counters.coastedInstanceNum++;
+				counters.skippedNodeNum += nodeNum;
+				continue;
+			}
+
+			unsigned int sampledNodeNum = nodeNum;
+			if (state.evaluated && level.cullBones) {
+				MODEL_LOD& modelLod = GetModelLod(job.model);
+				if (modelLod.maskNodeNum < nodeNum) {
+					job.updateMask = &modelLod.mask;
+					sampledNodeNum = modelLod.maskNodeNum;
+				}
+			}
+			counters.sampledInstanceNum++;
+			counters.sampledNodeNum += sampledNodeNum;
+			counters.skippedNodeNum += nodeNum - sampledNodeNum;
+			state.evaluated = true;
+		}
+		frame++;
+	}
+
+	void AnimationLod::Plan(const Camera3D* camera, std::vector<CROWD_JOB>& jobs, std::vector<ANIMATION_LOD_STATE>& states)
+	{
+		states.resize(jobs.size());
+		Plan(camera->GetPosition(), jobs.data(), states.data(), jobs.size());
+	}
+
+	const ANIMATION_LOD_COUNTERS& AnimationLod::GetCounters() const
+	{
+		return counters;
+	}
+
+} // namespace MG
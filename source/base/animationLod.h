@@ -0,0 +1,83 @@
+// =======================================================
+// animationLod.h
+//
+// Aj[VLODiڍדxj
+// J̋Ńx߁ACX^X
+// Et[Ɉ񂾂TvOiCX^XƂɈʑ炵ĕׂςjA
+//   ȊÕt[͑Õ[Jϊ̂܂܃[hs񂾂XV
+// EfƂɌ߂[艺̃m[hiwȂǂ̖[jTvOȂ
+//   iO̎p̂܂܎ĉŁAoCh|[Yɖ߂Ē˂Ȃj
+// Et߂ōsȂ悤AƂɕihysteresisj
+//
+// CROWD_JOBupdateMaskAcoast邾ŁA]CrowdEvaluatorōs
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _ANIMATION_LOD_H
+#define _ANIMATION_LOD_H
+
+#include "crowd.h"
+#include "camera.h"
+
+namespace MG {
+
+	struct ANIMATION_LOD_LEVEL {
+		float distance;				// ̋Kp
+		unsigned int updateInterval;	// t[ɈTvO邩i1Ȃ疈t[j
+		bool cullBones;				// fLOD[艺̃m[hTvOȂ
+	};
+
+	// CX^XƂɎԁiCROWD_JOBƓтŁj
+	struct ANIMATION_LOD_STATE {
+		unsigned int level = 0;
+		unsigned int phase = 0;
+		bool evaluated = false;		// x]ĂȂ΁AxɊ֌WȂSTvO
+	};
+
+	// t[̏Wv
+	struct ANIMATION_LOD_COUNTERS {
+		unsigned int instanceNum;
+		unsigned int levelInstanceNum[4];		// xƂ̃CX^Xi4ȏ͍Ōɑj
+		unsigned int sampledInstanceNum;		// TvOCX^X
+		unsigned int coastedInstanceNum;		// [hs񂾂XVCX^X
+		unsigned int sampledNodeNum;			// TvOm[h
+		unsigned int skippedNodeNum;			// LODŏȂm[hiSt[ȂKvƂ̍j
+	};
+
+	// [̏Ȃ
+	static constexpr unsigned int ANIMATION_LOD_DEPTH_FULL = 0xffffffff;
+
+	class AnimationLod {
+	private:
+		struct MODEL_LOD {
+			unsigned int depth = ANIMATION_LOD_DEPTH_FULL;
+			BoneMask mask;
+			unsigned int maskNodeNum = 0;
+		};
+		std::vector<ANIMATION_LOD_LEVEL> levels;
+		std::map<const Model*, MODEL_LOD> models;
+		float hysteresis = 0.1f;
+		unsigned int frame = 0;
+		unsigned int nextPhase = 0;
+		ANIMATION_LOD_COUNTERS counters = {};
+
+		MODEL_LOD& GetModelLod(const Model* model);
+		unsigned int SelectLevel(unsigned int currentLevel, float distance) const;
+	public:
+		//  0`:t[A20`:2t[A40`:4t[{[ȗA80`:8t[{[ȗ
+		AnimationLod();
+		void SetLevels(const std::vector<ANIMATION_LOD_LEVEL>& levels);
+		const std::vector<ANIMATION_LOD_LEVEL>& GetLevels() const;
+		void SetHysteresis(float hysteresis);
+		// [g̐[i[g0jdepth[m[hAcullBones̃xŏȂ
+		void SetModelDepth(const Model* model, unsigned int depth);
+
+		// jobsupdateMaskAcoast߁Aframei߂
+		void Plan(const F3& viewPosition, CROWD_JOB* jobs, ANIMATION_LOD_STATE* states, size_t jobNum);
+		void Plan(const Camera3D* camera, std::vector<CROWD_JOB>& jobs, std::vector<ANIMATION_LOD_STATE>& states);
+		const ANIMATION_LOD_COUNTERS& GetCounters() const;
+	};
+
+} // namespace MG
+
+#endif
@@ -0,0 +1,396 @@
+// =======================================================
+// animationStateMachine.cpp
+//
+// CSVŒ`Aj[VXe[g}V
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "animationStateMachine.h"
+#include <sstream>
+#include <algorithm>
+#include <assert.h>
+
+namespace MG {
+
+	// =======================================================
+	// CSV̓ǂݍ
+	// =======================================================
+	static std::string GetTableValue(const D_KVPAIR& row, const char* column, const std::string& defaultValue = "")
+	{
+		auto itr = row.find(column);
+		if (itr == row.end() || itr->second.empty()) {
+			return defaultValue;
+		}
+		return itr->second;
+	}
+
+	ANIMATION_STATE_MACHINE_CONFIG LoadAnimationStateMachineConfig(const D_KVTABLE& table)
+	{
+		ANIMATION_STATE_MACHINE_CONFIG config;
+		for (const auto& pair : table) {
+			const D_KVPAIR& row = pair.second;
+			std::string type = GetTableValue(row, "type");
+			if (type == "state") {
+				config.states.push_back({
+					pair.first,
+					GetTableValue(row, "animation"),
+					std::stoi(GetTableValue(row, "loop", "1")) != 0,
+					std::stof(GetTableValue(row, "length", "1000")),
+					GetTableValue(row, "rootMotion")
+				});
+			}
+			else if (type == "transition") {
+				config.transitions.push_back({
+					pair.first,
+					GetTableValue(row, "from"),
+					GetTableValue(row, "to"),
+					GetTableValue(row, "condition"),
+					std::stof(GetTableValue(row, "blend", "300"))
+				});
+			}
+			else if (type == "entry") {
+				config.entry = GetTableValue(row, "to");
+			}
+		}
+		return config;
+	}
+
+
+	// =======================================================
+	// 
+	// Aj[V̓ǂݍ݁AOԍւ̕ϊA
+	// ]Ŏgobt@̊mۂ͂őSς܂
+	// `sȂfalseԂAȂXe[g}VɂȂiRGetErrorj
+	// =======================================================
+	bool AnimationStateMachine::Init(const Model* model, const ANIMATION_STATE_MACHINE_CONFIG& config)
+	{
+		this->model = model;
+		error.clear();
+
+		states.clear();
+		states.resize(config.states.size());
+		for (size_t i = 0; i < config.states.size(); i++) {
+			const ANIMATION_STATE_CONFIG& stateConfig = config.states[i];
+			STATE& state = states[i];
+			state.name = stateConfig.name;
+			state.loop = stateConfig.loop;
+			state.length = stateConfig.length;
+			if (!stateConfig.animation.empty()) {
+				// [g[V𔲂ô͕ʂ̃\[XiقŎgt@C͏Ȃj
+				state.animation = LoadAnimation(stateConfig.animation, RESOURCE_SCOPE_GOBAL, ANIMATION_LOAD_MODE_KEY, stateConfig.rootMotion);
+				state.binding = GetAnimationBinding(model, state.animation);
+				state.rootMotion = state.animation->HasRootMotion();
+				if (state.animation->rawAnimation->channelNum > 0) {
+					state.cursor.GetChannelCursor(state.animation, 0);
+				}
+			}
+		}
+
+		conditionNames.clear();
+		conditionBits = 0;
+		endCondition = AddCondition(ANIMATION_CONDITION_END);
+
+		transitions.clear();
+		for (const ANIMATION_TRANSITION_CONFIG& transitionConfig : config.transitions) {
+			TRANSITION transition = {
+				GetStateIndex(transitionConfig.from.c_str()),
+				GetStateIndex(transitionConfig.to.c_str()),
+				0, 0,
+				transitionConfig.blendTime
+			};
+			if (transition.from == ANIMATION_STATE_NONE || transition.to == ANIMATION_STATE_NONE) {
+				return Reject("transition " + transitionConfig.name + ": unknown state");
+			}
+
+			// uA&!BvK{rbgƋ֎~rbgɕ
+			std::stringstream ss(transitionConfig.condition);
+			std::string term;
+			while (getline(ss, term, '&')) {
+				bool negative = !term.empty() && term[0] == '!';
+				if (negative) {
+					term = term.substr(1);
+				}
+				if (term.empty()) {
+					continue;
+				}
+				unsigned int condition = AddCondition(term);
+				if (condition == ANIMATION_STATE_NONE) {
+					return Reject("transition " + transitionConfig.name + ": too many conditions (" + term + ")");
+				}
+				unsigned int bit = 1u << condition;
+				if (negative) {
+					transition.forbidBits |= bit;
+				}
+				else {
+					transition.requireBits |= bit;
+				}
+			}
+			transitions.push_back(transition);
+		}
+
+		currentState = GetStateIndex(config.entry.c_str());
+		if (currentState == ANIMATION_STATE_NONE && !states.empty()) {
+			currentState = 0;
+		}
+		previousState = ANIMATION_STATE_NONE;
+		transitionCount = 0;
+		evaluated = false;
+
+		unsigned int nodeNum = model->nodeNum;
+		inertialization.Reset(0.0f);
+		inertialization.Reserve(nodeNum);
+		previousPose.Resize(nodeNum);
+		applicants.reserve(1);
+		activeStates.reserve(2);
+		activeStates.clear();
+		activeStates.push_back(currentState);
+		return true;
+	}
+
+	// rbgȂANIMATION_STATE_NONEi1u << 32ɂȂȂ悤Ɂj
+	unsigned int AnimationStateMachine::AddCondition(const std::string& name)
+	{
+		unsigned int index = GetConditionIndex(name.c_str());
+		if (index != ANIMATION_STATE_NONE) {
+			return index;
+		}
+		if (conditionNames.size() >= ANIMATION_CONDITION_MAX) {
+			return ANIMATION_STATE_NONE;
+		}
+		conditionNames.push_back(name);
+		return (unsigned int)conditionNames.size() - 1;
+	}
+
+	// r܂ō̂̂ĂāAUpdateEvaluateȂԂɂ
+	bool AnimationStateMachine::Reject(const std::string& message)
+	{
+		error = message;
+		states.clear();
+		transitions.clear();
+		conditionNames.clear();
+		conditionBits = 0;
+		endCondition = ANIMATION_STATE_NONE;
+		currentState = ANIMATION_STATE_NONE;
+		previousState = ANIMATION_STATE_NONE;
+		transitionCount = 0;
+		evaluated = false;
+		activeStates.clear();
+		return false;
+	}
+
+	const std::string& AnimationStateMachine::GetError() const
+	{
+		return error;
+	}
+
+	bool AnimationStateMachine::IsStateEnd(const STATE& state) const
+	{
+		return !state.loop && state.time >= state.length;
+	}
+
+
+	// =======================================================
+	// 
+	// t[OŐݒ肷ꍇrŊmۂ͂Ȃ
+	// =======================================================
+	unsigned int AnimationStateMachine::GetConditionIndex(const char* name) const
+	{
+		for (size_t i = 0; i < conditionNames.size(); i++) {
+			if (conditionNames[i] == name) {
+				return (unsigned int)i;
+			}
+		}
+		return ANIMATION_STATE_NONE;
+	}
+
+	void AnimationStateMachine::SetCondition(unsigned int conditionIndex, bool value)
+	{
+		if (conditionIndex >= ANIMATION_CONDITION_MAX) {
+			return;
+		}
+		if (value) {
+			conditionBits |= 1u << conditionIndex;
+		}
+		else {
+			conditionBits &= ~(1u << conditionIndex);
+		}
+	}
+
+	void AnimationStateMachine::SetCondition(const char* name, bool value)
+	{
+		SetCondition(GetConditionIndex(name), value);
+	}
+
+
+	// =======================================================
+	// XV
+	// ݂̏Ԃ̎ԂőJڂ𔻒肵AJڂȂΎԂi߂
+	// Jڐ͎0n܂
+	// [g[VƃCxg݂͌̏Ԃi񂾕iJڂt[͂Ȃj
+	// =======================================================
+	void AnimationStateMachine::Update(float deltaTime)
+	{
+		rootMotion = {};
+		eventTrack = nullptr;
+		eventRangeNum = 0;
+		if (currentState == ANIMATION_STATE_NONE) {
+			return;
+		}
+
+		unsigned int bits = conditionBits;
+		if (IsStateEnd(states[currentState])) {
+			bits |= 1u << endCondition;
+		}
+
+		bool transited = false;
+		for (const TRANSITION& transition : transitions) {
+			if (transition.from != currentState) {
+				continue;
+			}
+			if ((bits & transition.requireBits) != transition.requireBits || (bits & transition.forbidBits)) {
+				continue;
+			}
+			previousState = currentState;
+			currentState = transition.to;
+			states[currentState].time = 0.0f;
+			states[currentState].cursor.Reset();
+			inertialization.Reset(transition.blendTime);
+			transitionCount++;
+			transited = true;
+			break;
+		}
+
+		if (!transited) {
+			STATE& state = states[currentState];
+			float previousTime = state.time;
+			state.time += deltaTime;
+			if (state.animation && state.length > 0.0f) {
+				float frames = state.animation->rawAnimation->frames;
+				float time = state.loop ? state.time : std::min(state.time, state.length);
+				float frame0 = frames * previousTime / state.length;
+				float frame1 = frames * time / state.length;
+				if (state.rootMotion) {
+					rootMotion = state.animation->GetRootMotionDelta(frame0, frame1, state.loop);
+				}
+				eventTrack = &state.animation->events;
+				eventRangeNum = eventTrack->Query(frame0, frame1, frames, state.loop, eventRanges);
+			}
+			if (state.loop) {
+				while (state.length > 0.0f && state.time >= state.length) {
+					state.time -= state.length;
+				}
+			}
+			else if (state.time > state.length) {
+				state.time = state.length;
+			}
+		}
+
+		activeStates.clear();
+		activeStates.push_back(currentState);
+		if (previousState != ANIMATION_STATE_NONE && !inertialization.IsFinished()) {
+			activeStates.push_back(previousState);
+		}
+	}
+
+
+	// =======================================================
+	// p̕]i[Jϊ܂Łj
+	// ݂̏Ԃ]āAJڒ͊Ԃ̍𑫂
+	// =======================================================
+	void AnimationStateMachine::Evaluate(Pose& pose, float deltaTime)
+	{
+		if (currentState == ANIMATION_STATE_NONE) {
+			return;
+		}
+
+		STATE& state = states[currentState];
+		applicants.clear();
+		if (state.animation) {
+			float t = (state.length > 0.0f) ? state.time / state.length : 1.0f;
+			applicants.push_back({ state.animation, state.animation->rawAnimation->frames * t, &state.cursor, state.binding });
+		}
+		inertialization.Evaluate(model, pose, previousPose, applicants, deltaTime);
+		if (!evaluated) {
+			// ŏ̃t[͑O̎pȂ̂ŁAx0ɂȂ悤ɍ̎pŖ߂
+			previousPose = pose;
+			evaluated = true;
+		}
+	}
+
+
+	// =======================================================
+	// OUpdateŐi񂾃[g[V
+	// Ԃ̊Jňɂړƃ[A
+	// LN^[̌ŉ񂵂ĈʒuɑideltaTimeŊΑxj
+	// =======================================================
+	const ROOT_MOTION_DELTA& AnimationStateMachine::GetRootMotion() const
+	{
+		return rootMotion;
+	}
+
+
+	// =======================================================
+	// OUpdateŒʉ߂Cxgit[A[v̏I[܂łԂǂj
+	// =======================================================
+	unsigned int AnimationStateMachine::GetEventNum() const
+	{
+		unsigned int eventNum = 0;
+		for (unsigned int i = 0; i < eventRangeNum; i++) {
+			eventNum += eventRanges[i].num;
+		}
+		return eventNum;
+	}
+
+	const ANIMATION_EVENT& AnimationStateMachine::GetEvent(unsigned int index) const
+	{
+		for (unsigned int i = 0; i < eventRangeNum; i++) {
+			if (index < eventRanges[i].num) {
+				return eventTrack->GetEvent(eventRanges[i].first + index);
+			}
+			index -= eventRanges[i].num;
+		}
+		assert(false);
+		return eventTrack->GetEvent(0);
+	}
+
+
+	// =======================================================
+	// vt@Cp
+	// =======================================================
+	unsigned int AnimationStateMachine::GetStateIndex(const char* name) const
+	{
+		for (size_t i = 0; i < states.size(); i++) {
+			if (states[i].name == name) {
+				return (unsigned int)i;
+			}
+		}
+		return ANIMATION_STATE_NONE;
+	}
+
+	unsigned int AnimationStateMachine::GetCurrentState() const
+	{
+		return currentState;
+	}
+
+	const std::string& AnimationStateMachine::GetStateName(unsigned int stateIndex) const
+	{
+		return states[stateIndex].name;
+	}
+
+	float AnimationStateMachine::GetStateTime(unsigned int stateIndex) const
+	{
+		return states[stateIndex].time;
+	}
+
+	// ]̏ԁȉ݂ԂƁAJڒȂJڌj
+	const std::vector<unsigned int>& AnimationStateMachine::GetActiveStates() const
+	{
+		return activeStates;
+	}
+
+	unsigned int AnimationStateMachine::GetTransitionCount() const
+	{
+		return transitionCount;
+	}
+
+} // namespace MG
@@ -0,0 +1,131 @@
+// =======================================================
+// animationStateMachine.h
+//
+// CSVŒ`Aj[VXe[g}V
+// ԁiAj[VA[vAjƑJځiAuhԁj
+// LoadConfigoRœǂݍ݁AJڂ͊Ԃōs
+// ͕]ŃmۂȂ
+//
+// CSV̗Fkey,type,animation,loop,length,from,to,condition,blend,rootMotion
+//   type=state      FanimationiȂoCh|[YjAloopi0/1jAlengthi~bjA
+//                     rootMotioni[g[V𔲂om[hAȂ甲oȂj
+//   type=transition FfromAtoAconditionAblendi~bj
+//   type=entry      Ftoiŏ̏ԁj
+// Ԃ̃Aj[VɃCxggbN΁AUpdateŒʉ߂̂Ԃ
+// conditiońu&v؂A擪́u!vŔےAEND̓[vȂԂ̍ĐI
+// Jڌŕ̑JڂꂽkeyŐ̂
+// END܂߂ANIMATION_CONDITION_MAX𒴂AJڐ悪sȂǂ̒`InitŒe
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _ANIMATION_STATE_MACHINE_H
+#define _ANIMATION_STATE_MACHINE_H
+
+#include "inertialization.h"
+#include "resourceTool.h"
+#include "CSVResource.h"
+
+namespace MG {
+
+	static constexpr unsigned int ANIMATION_STATE_NONE = 0xFFFFFFFF;
+	static constexpr unsigned int ANIMATION_CONDITION_MAX = 32;
+	static constexpr const char* ANIMATION_CONDITION_END = "END";
+
+	// CSVǂݍ񂾂܂܂̒`
+	struct ANIMATION_STATE_CONFIG {
+		std::string name;
+		std::string animation;
+		bool loop = true;
+		float length = 1000.0f;
+		std::string rootMotion;
+	};
+
+	struct ANIMATION_TRANSITION_CONFIG {
+		std::string name;
+		std::string from;
+		std::string to;
+		std::string condition;
+		float blendTime = 300.0f;
+	};
+
+	struct ANIMATION_STATE_MACHINE_CONFIG {
+		std::vector<ANIMATION_STATE_CONFIG> states;
+		std::vector<ANIMATION_TRANSITION_CONFIG> transitions;
+		std::string entry;
+	};
+
+	// LoadConfig<ANIMATION_STATE_MACHINE_CONFIG>ɓnϊ֐
+	ANIMATION_STATE_MACHINE_CONFIG LoadAnimationStateMachineConfig(const D_KVTABLE& table);
+
+	// =======================================================
+	// Xe[g}V{
+	// =======================================================
+	class AnimationStateMachine {
+	private:
+		struct STATE {
+			std::string name;
+			Animation* animation = nullptr;
+			const AnimationBinding* binding = nullptr;
+			AnimationCursor cursor;
+			bool loop = true;
+			float length = 1000.0f;
+			float time = 0.0f;
+			bool rootMotion = false;
+		};
+
+		struct TRANSITION {
+			unsigned int from;
+			unsigned int to;
+			unsigned int requireBits;	// ĂȂ΂ȂȂ
+			unsigned int forbidBits;	// ĂĂ͂ȂȂ
+			float blendTime;
+		};
+
+		const Model* model = nullptr;
+		std::vector<STATE> states;
+		std::vector<TRANSITION> transitions;
+		std::vector<std::string> conditionNames;
+		unsigned int conditionBits = 0;
+		unsigned int endCondition = ANIMATION_STATE_NONE;
+		unsigned int currentState = ANIMATION_STATE_NONE;
+		unsigned int previousState = ANIMATION_STATE_NONE;
+		unsigned int transitionCount = 0;
+		bool evaluated = false;
+		ROOT_MOTION_DELTA rootMotion;	// OUpdateŐi񂾕
+		const AnimationEventTrack* eventTrack = nullptr;	// OUpdateŒʉ߂Cxg
+		ANIMATION_EVENT_RANGE eventRanges[ANIMATION_EVENT_RANGE_MAX];
+		unsigned int eventRangeNum = 0;
+		Inertialization inertialization;
+		Pose previousPose;
+		std::vector<ANIMATION_APPLICANT> applicants;	// ]pig񂷁j
+		std::vector<unsigned int> activeStates;		// vt@Cpig񂷁j
+		std::string error;	// InitŒeR
+
+		unsigned int AddCondition(const std::string& name);
+		bool Reject(const std::string& message);
+		bool IsStateEnd(const STATE& state) const;
+	public:
+		bool Init(const Model* model, const ANIMATION_STATE_MACHINE_CONFIG& config);
+		const std::string& GetError() const;
+
+		unsigned int GetConditionIndex(const char* name) const;
+		void SetCondition(unsigned int conditionIndex, bool value);
+		void SetCondition(const char* name, bool value);
+
+		void Update(float deltaTime);
+		void Evaluate(Pose& pose, float deltaTime);
+		const ROOT_MOTION_DELTA& GetRootMotion() const;
+		unsigned int GetEventNum() const;
+		const ANIMATION_EVENT& GetEvent(unsigned int index) const;
+
+		unsigned int GetStateIndex(const char* name) const;
+		unsigned int GetCurrentState() const;
+		const std::string& GetStateName(unsigned int stateIndex) const;
+		float GetStateTime(unsigned int stateIndex) const;
+		const std::vector<unsigned int>& GetActiveStates() const;
+		unsigned int GetTransitionCount() const;
+	};
+
+} // namespace MG
+
+#endif
@@ -0,0 +1,198 @@
+// =======================================================
+// bonePartition.cpp
+//
+// {[ŕ郁bV
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "bonePartition.h"
+#include <algorithm>
+
+namespace MG {
+
+	// _QƂe̐iVERTEX_BONE_WEIGHTƓj
+	static constexpr unsigned int VERTEX_INFLUENCE_NUM = 4;
+	static constexpr unsigned int NONE = 0xffffffff;
+
+	// =======================================================
+	// i×~@j
+	//
+	// bV
+	// Op`ƂɁu܂bVɖ{[̐vimissingjA
+	// {[𑫂тɂ̃{[gOp`missing炵āA0ɂȂ͎̂荞
+	// {[́Ac̘gɎ܂钆missingԏȂOp`I
+	// iȂԍ̏̕тɋ߂ŁA_̕炷j
+	// =======================================================
+	bool PartitionMeshBones(const MESH* mesh, unsigned int maxBones, std::vector<BONE_PARTITION>& partitions)
+	{
+		partitions.clear();
+		if (mesh->primitiveType != PRIMITIVE_TYPE_TRIANGLE || maxBones == 0) {
+			return false;
+		}
+		unsigned int triangleNum = mesh->vertexIndexNum / 3;
+		unsigned int boneNum = mesh->boneNum;
+
+		// Op`Ƃ̎Qƃ{[idȂj
+		std::vector<unsigned int> triangleBoneStart(triangleNum + 1);
+		std::vector<unsigned int> triangleBones;
+		triangleBones.reserve(triangleNum * 4);
+		for (unsigned int t = 0; t < triangleNum; t++) {
+			triangleBoneStart[t] = (unsigned int)triangleBones.size();
+			for (unsigned int c = 0; c < 3; c++) {
+				const VERTEX_BONE_WEIGHT& boneWeight = mesh->boneWeights[mesh->vertexIndexes[t * 3 + c]];
+				for (unsigned int k = 0; k < VERTEX_INFLUENCE_NUM; k++) {
+					unsigned int bone = boneWeight.boneIndexes[k];
+					if (boneWeight.weights[k] == 0.0f || bone >= boneNum) {
+						continue;
+					}
+					bool found = false;
+					for (unsigned int j = triangleBoneStart[t]; j < triangleBones.size(); j++) {
+						found |= triangleBones[j] == bone;
+					}
+					if (!found) {
+						triangleBones.push_back(bone);
+					}
+				}
+			}
+			if (triangleBones.size() - triangleBoneStart[t] > maxBones) {
+				return false;
+			}
+		}
+		triangleBoneStart[triangleNum] = (unsigned int)triangleBones.size();
+
+		// {[  gOp`
+		std::vector<unsigned int> boneTriangleStart(boneNum + 1, 0);
+		for (unsigned int bone : triangleBones) {
+			boneTriangleStart[bone + 1]++;
+		}
+		for (unsigned int b = 0; b < boneNum; b++) {
+			boneTriangleStart[b + 1] += boneTriangleStart[b];
+		}
+		std::vector<unsigned int> boneTriangles(triangleBones.size());
+		{
+			std::vector<unsigned int> cursor(boneTriangleStart.begin(), boneTriangleStart.end() - 1);
+			for (unsigned int t = 0; t < triangleNum; t++) {
+				for (unsigned int j = triangleBoneStart[t]; j < triangleBoneStart[t + 1]; j++) {
+					boneTriangles[cursor[triangleBones[j]]++] = t;
+				}
+			}
+		}
+
+		std::vector<bool> assigned(triangleNum, false);
+		std::vector<unsigned int> missing(triangleNum);
+		std::vector<unsigned int> localBone(boneNum, NONE);
+		std::vector<unsigned int> localVertex(mesh->vertexNum, NONE);
+		unsigned int assignedNum = 0;
+
+		while (assignedNum < triangleNum) {
+			partitions.emplace_back();
+			BONE_PARTITION& partition = partitions.back();
+			std::vector<unsigned int> triangles;
+
+			for (unsigned int t = 0; t < triangleNum; t++) {
+				missing[t] = triangleBoneStart[t + 1] - triangleBoneStart[t];
+			}
+
+			auto take = [&](unsigned int t) {
+				assigned[t] = true;
+				assignedNum++;
+				triangles.push_back(t);
+			};
+			auto addBone = [&](unsigned int bone) {
+				localBone[bone] = (unsigned int)partition.bones.size();
+				partition.bones.push_back(bone);
+				for (unsigned int j = boneTriangleStart[bone]; j < boneTriangleStart[bone + 1]; j++) {
+					unsigned int t = boneTriangles[j];
+					if (!assigned[t] && --missing[t] == 0) {
+						take(t);
+					}
+				}
+			};
+
+			// {[gȂOp`͍ŏ̕bVɓ
+			if (partitions.size() == 1) {
+				for (unsigned int t = 0; t < triangleNum; t++) {
+					if (missing[t] == 0) {
+						take(t);
+					}
+				}
+			}
+
+			while (true) {
+				unsigned int room = maxBones - (unsigned int)partition.bones.size();
+				unsigned int best = NONE;
+				for (unsigned int t = 0; t < triangleNum; t++) {
+					if (!assigned[t] && missing[t] <= room && (best == NONE || missing[t] < missing[best])) {
+						best = t;
+						if (missing[t] == 1) {
+							break;
+						}
+					}
+				}
+				if (best == NONE) {
+					break;
+				}
+				for (unsigned int j = triangleBoneStart[best]; j < triangleBoneStart[best + 1]; j++) {
+					if (localBone[triangleBones[j]] == NONE) {
+						addBone(triangleBones[j]);
+					}
+				}
+			}
+
+			// ̕яŒ_ƃCfbNX
+			std::sort(triangles.begin(), triangles.end());
+			partition.vertexIndexes.reserve(triangles.size() * 3);
+			for (unsigned int t : triangles) {
+				for (unsigned int c = 0; c < 3; c++) {
+					unsigned int source = mesh->vertexIndexes[t * 3 + c];
+					if (localVertex[source] == NONE) {
+						localVertex[source] = (unsigned int)partition.vertexSources.size();
+						partition.vertexSources.push_back(source);
+					}
+					partition.vertexIndexes.push_back(localVertex[source]);
+				}
+			}
+			if (partition.bones.empty()) {
+				partition.bones.push_back(0);
+			}
+			partition.vertices.reserve(partition.vertexSources.size());
+			partition.boneWeights.reserve(partition.vertexSources.size());
+			for (unsigned int source : partition.vertexSources) {
+				VERTEX_BONE_WEIGHT boneWeight = mesh->boneWeights[source];
+				for (unsigned int k = 0; k < VERTEX_INFLUENCE_NUM; k++) {
+					unsigned int bone = boneWeight.boneIndexes[k];
+					boneWeight.boneIndexes[k] = (boneWeight.weights[k] == 0.0f || bone >= boneNum) ? 0 : localBone[bone];
+				}
+				partition.vertices.push_back(mesh->vertices[source]);
+				partition.boneWeights.push_back(boneWeight);
+			}
+
+			// ̕bV̂߂ɖ߂
+			for (unsigned int bone : partition.bones) {
+				if (bone < boneNum) {
+					localBone[bone] = NONE;
+				}
+			}
+			for (unsigned int source : partition.vertexSources) {
+				localVertex[source] = NONE;
+			}
+		}
+		return true;
+	}
+
+	BONE_PARTITION_STATS GetBonePartitionStats(const MESH* mesh, const std::vector<BONE_PARTITION>& partitions)
+	{
+		BONE_PARTITION_STATS stats = {};
+		stats.partitionNum = (unsigned int)partitions.size();
+		stats.sourceVertexNum = mesh->vertexNum;
+		for (const BONE_PARTITION& partition : partitions) {
+			stats.vertexNum += (unsigned int)partition.vertexSources.size();
+			if (partition.bones.size() > stats.maxBoneNum) {
+				stats.maxBoneNum = (unsigned int)partition.bones.size();
+			}
+		}
+		stats.duplicationRatio = stats.sourceVertexNum ? (float)stats.vertexNum / stats.sourceVertexNum : 0.0f;
+		return stats;
+	}
+
+} // namespace MG
@@ -0,0 +1,44 @@
+// =======================================================
+// bonePartition.h
+//
+// {[ŕ郁bV
+// VF[_[̃pbgɓ肫ȂiSKIN_PALETTE_MAX葽j{[bVA
+// Op`ƂɎQƃ{[maxBones{ȉɂȂ镔bVɕ
+// {[ԍ͕bV̔ԍɕtւAbVmŋL钸_
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _BONE_PARTITION_H
+#define _BONE_PARTITION_H
+
+#include "skinning.h"
+
+namespace MG {
+
+	// bV
+	struct BONE_PARTITION {
+		std::vector<unsigned int> bones;					// ̃{[ԍ  bṼ{[ԍ
+		std::vector<unsigned int> vertexSources;			// ̒_ԍ  bV̒_ԍ
+		std::vector<VERTEX> vertices;
+		std::vector<VERTEX_BONE_WEIGHT> boneWeights;		// {[ԍ͕̔ԍ
+		std::vector<unsigned int> vertexIndexes;			// ̒_ԍ
+	};
+
+	struct BONE_PARTITION_STATS {
+		unsigned int partitionNum;
+		unsigned int sourceVertexNum;	// ̃bV̒_
+		unsigned int vertexNum;			// bV̒_̍v
+		unsigned int maxBoneNum;		// ԑbṼ{[
+		float duplicationRatio;			// vertexNum / sourceVertexNum
+	};
+
+	// Op`bVΏ
+	// ̎Op`maxBones𒴂AOp`ȊOȂǂŕȂƂfalse
+	// d0̉e̓{[ƂĐȂiԍ͕0ɂj
+	bool PartitionMeshBones(const MESH* mesh, unsigned int maxBones, std::vector<BONE_PARTITION>& partitions);
+
+	BONE_PARTITION_STATS GetBonePartitionStats(const MESH* mesh, const std::vector<BONE_PARTITION>& partitions);
+
+} // namespace MG
+
+#endif
@@ -0,0 +1,185 @@
+// =======================================================
+// crowd.cpp
+//
+// QOAj[V̕]
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "crowd.h"
+#include "resourceTool.h"
+
+namespace MG {
+
+	// xɎWui荇̉񐔂Ƃ΂̌ˍj
+	static constexpr size_t CROWD_JOB_CHUNK = 4;
+
+	// =======================================================
+	// 򂲂ƂɎ荇s
+	// =======================================================
+	ChunkedJobPool::ChunkedJobPool(unsigned int threadNum)
+	{
+		if (threadNum == 0) {
+			threadNum = 1;
+		}
+		workers.reserve(threadNum - 1);
+		for (unsigned int i = 1; i < threadNum; i++) {
+			workers.emplace_back(&ChunkedJobPool::WorkerLoop, this);
+		}
+	}
+
+	ChunkedJobPool::~ChunkedJobPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		startCondition.notify_all();
+		for (std::thread& worker : workers) {
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+	}
+
+	unsigned int ChunkedJobPool::GetThreadNum() const
+	{
+		return (unsigned int)workers.size() + 1;
+	}
+
+	// c肪ȂȂ܂chunkď
+	void ChunkedJobPool::RunChunks()
+	{
+		while (true) {
+			size_t begin = nextItem.fetch_add(chunk);
+			if (begin >= itemNum) {
+				break;
+			}
+			function(context, begin, std::min(begin + chunk, itemNum));
+		}
+	}
+
+	void ChunkedJobPool::WorkerLoop()
+	{
+		unsigned int lastGeneration = 0;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				startCondition.wait(lock, [&]() { return quit || generation != lastGeneration; });
+				if (quit) {
+					return;
+				}
+				lastGeneration = generation;
+			}
+
+			RunChunks();
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				runningWorkers--;
+			}
+			finishCondition.notify_one();
+		}
+	}
+
+	// [J[NāAĂяõXbhꏏɏ
+	// Ɏ܂Ȃ烏[J[Nɂ̏ŏ
+	void ChunkedJobPool::Run(size_t itemNum, size_t chunk, CHUNK_FUNCTION function, const void* context)
+	{
+		if (itemNum == 0) {
+			return;
+		}
+		if (chunk == 0) {
+			chunk = 1;
+		}
+
+		if (workers.empty() || itemNum <= chunk) {
+			function(context, 0, itemNum);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			this->function = function;
+			this->context = context;
+			this->itemNum = itemNum;
+			this->chunk = chunk;
+			nextItem = 0;
+			runningWorkers = (unsigned int)workers.size();
+			generation++;
+		}
+		startCondition.notify_all();
+
+		RunChunks();
+
+		std::unique_lock<std::mutex> lock(mutex);
+		finishCondition.wait(lock, [&]() { return runningWorkers == 0; });
+	}
+
+
+	// =======================================================
+	// QO]
+	// =======================================================
+	CrowdEvaluator::CrowdEvaluator(unsigned int threadNum)
+		: pool(threadNum)
+	{
+	}
+
+	CrowdEvaluator::~CrowdEvaluator()
+	{
+	}
+
+	unsigned int CrowdEvaluator::GetThreadNum() const
+	{
+		return pool.GetThreadNum();
+	}
+
+	static void EvaluateJob(const CROWD_JOB& job)
+	{
+		if (job.sharedPose) {
+			job.pose->Resize(job.model->nodeNum);
+			std::copy(job.sharedPose->GetLocals(), job.sharedPose->GetLocals() + job.model->nodeNum, job.pose->GetLocals());
+			UpdateNodeWorldTransforms(job.model, job.worldTransform, *job.pose);
+		}
+		else if (job.localsOnly) {
+			if (job.animationApplicants) {
+				LoadNodeLocalTransforms(job.model, *job.pose, *job.animationApplicants);
+			}
+			else {
+				LoadNodeLocalTransforms(job.model, *job.pose);
+			}
+		}
+		else if (job.coast) {
+			UpdateNodeWorldTransforms(job.model, job.worldTransform, *job.pose);
+		}
+		else if (job.animationApplicants && job.updateMask) {
+			LoadNodeLocalTransforms(job.model, *job.pose, *job.animationApplicants, *job.updateMask);
+			UpdateNodeWorldTransforms(job.model, job.worldTransform, *job.pose);
+		}
+		else if (job.animationApplicants) {
+			LoadNodeWorldTransforms(job.model, job.worldTransform, *job.pose, *job.animationApplicants);
+		}
+		else {
+			LoadNodeWorldTransforms(job.model, job.worldTransform, *job.pose);
+		}
+	}
+
+
+	// =======================================================
+	// ]
+	// SI܂Ŗ߂Ȃ
+	// =======================================================
+	void CrowdEvaluator::Evaluate(const CROWD_JOB* jobs, size_t jobNum)
+	{
+		pool.Run(jobNum, CROWD_JOB_CHUNK, [jobs](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				EvaluateJob(jobs[i]);
+			}
+		});
+	}
+
+	void CrowdEvaluator::Evaluate(const std::vector<CROWD_JOB>& jobs)
+	{
+		Evaluate(jobs.data(), jobs.size());
+	}
+
+} // namespace MG
@@ -0,0 +1,105 @@
+// =======================================================
+// crowd.h
+//
+// QOAj[V̕]
+// ifAAj[VA[hsj̃Wu܂Ƃ߂Ď󂯎A
+// TvOƃ[hšvZ[J[XbhɐU蕪
+// ʂ̓WuƂPoseɏ
+// [J[̊Ǘ͉򂲂ƂɎ荇ėp̃v[iChunkedJobPoolAXLjOgj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _CROWD_H
+#define _CROWD_H
+
+#include "pose.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace MG {
+
+	// ̃̕Wu
+	// AnimationCursor𕡐̃WuŋLȂƁiWuƂɎAnullptrj
+	struct CROWD_JOB {
+		const Model* model;
+		const std::vector<ANIMATION_APPLICANT>* animationApplicants;	// nullptrȂoCh|[Y
+		M4x4 worldTransform;
+		Pose* pose;
+		// Aj[VLODianimationLod.hjݒ肷
+		const BoneMask* updateMask = nullptr;	// Oꂽm[h͑O̎p̂܂܁AnullptrȂS
+		bool coast = false;						// trueȂTvOAÕ[JϊŃ[hs񂾂XV
+		// LpLbViposeCache.hjݒ肷
+		const Pose* sharedPose = nullptr;		// ΂̃[JϊRs[āA[hs񂾂vZ
+		bool localsOnly = false;				// trueȂ烍[Jϊi[hs͌vZȂj
+	};
+
+	// =======================================================
+	// 򂲂ƂɎ荇s
+	//
+	// threadNum͌ĂяõXbh܂߂
+	// [J[͍쐬ɋNđҋ@ARun̂тɋN
+	// Run[0, itemNum)chunkfunctionɓnASI܂Ŗ߂Ȃ
+	// 荇̂ŁAdĂ΂Ȃ
+	// function͊֐|C^contextŎ󂯂iRun̂тɊmۂȂj
+	// =======================================================
+	class ChunkedJobPool {
+	public:
+		typedef void (*CHUNK_FUNCTION)(const void* context, size_t begin, size_t end);
+	private:
+		std::vector<std::thread> workers;
+		std::mutex mutex;
+		std::condition_variable startCondition;
+		std::condition_variable finishCondition;
+		CHUNK_FUNCTION function = nullptr;
+		const void* context = nullptr;
+		size_t itemNum = 0;
+		size_t chunk = 1;
+		std::atomic<size_t> nextItem{ 0 };
+		unsigned int generation = 0;
+		unsigned int runningWorkers = 0;
+		bool quit = false;
+
+		void WorkerLoop();
+		void RunChunks();
+	public:
+		ChunkedJobPool(unsigned int threadNum = std::thread::hardware_concurrency());
+		~ChunkedJobPool();
+		ChunkedJobPool(const ChunkedJobPool&) = delete;
+		ChunkedJobPool& operator=(const ChunkedJobPool&) = delete;
+
+		unsigned int GetThreadNum() const;
+		void Run(size_t itemNum, size_t chunk, CHUNK_FUNCTION function, const void* context);
+
+		// (begin, end)ŌẮׂiLv`t̃_Ȃǁj
+		template<class FUNCTION>
+		void Run(size_t itemNum, size_t chunk, const FUNCTION& function)
+		{
+			Run(itemNum, chunk, [](const void* context, size_t begin, size_t end) {
+				(*(const FUNCTION*)context)(begin, end);
+			}, &function);
+		}
+	};
+
+	// =======================================================
+	// QO]
+	// WuChunkedJobPoolŏ荇ĕ]
+	// =======================================================
+	class CrowdEvaluator {
+	private:
+		ChunkedJobPool pool;
+	public:
+		CrowdEvaluator(unsigned int threadNum = std::thread::hardware_concurrency());
+		~CrowdEvaluator();
+		CrowdEvaluator(const CrowdEvaluator&) = delete;
+		CrowdEvaluator& operator=(const CrowdEvaluator&) = delete;
+
+		unsigned int GetThreadNum() const;
+		void Evaluate(const CROWD_JOB* jobs, size_t jobNum);
+		void Evaluate(const std::vector<CROWD_JOB>& jobs);
+	};
+
+} // namespace MG
+
+#endif
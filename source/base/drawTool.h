@@ -10,6 +10,8 @@
 
 #include "MGCommon.h"
 #include "collision.h"
+#include "pose.h"
+#include "skinning.h"
 
 namespace MG {
 
@@ -58,6 +60,12 @@ namespace MG {
 			const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }
 		) = 0;
 
+		virtual void DrawModel(
+			const Model* model,
+			const Pose& pose,
+			const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }
+		) = 0;
+
 		virtual void DrawPolygon(const Texture* texture, const VERTEX* vertices, size_t length,
 			TOPOLOGY topology = TOPOLOGY_TRIANGLESTRIP,
 			const F3& position = { 0.0f, 0.0f, 0.0f },
@@ -69,6 +77,10 @@ namespace MG {
 		) = 0;
 
 		virtual void DrawCube(const M4x4& matrix, const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }) = 0;
+
+		// XLbV̕ό`@iSKINNING_MODE_LINEARj
+		virtual void SetSkinningMode(SKINNING_MODE mode) = 0;
+		virtual SKINNING_MODE GetSkinningMode() const = 0;
 	};
 
 } // namespace MG
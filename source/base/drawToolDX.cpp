@@ -7,6 +7,7 @@
 // =======================================================
 #include "drawToolDX.h"
 #include "rendererDX.h"
+#include "skinning.h"
 
 namespace MG {
 
@@ -16,13 +17,11 @@ namespace MG {
 	static ID3D11Buffer* g_PolygonVertexBuffer = NULL;
 	static constexpr const int POLYGON_VERTEX_BUFFER_LENGTH = 1000;
 
-	void DrawToolDX::DrawModelNode(ModelDX* model, MODEL_NODE* const node, const std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms)
+	void DrawToolDX::DrawModelNode(ModelDX* model, MODEL_NODE* const node, const Pose& pose)
 	{
 		if (strcmp(node->instance, "")) return;
 
-		string name = node->name;
-
-		M4x4 worldM4x4 = nodeWorldTransforms.at(node);
+		M4x4 worldM4x4 = pose.GetWorld(model->GetNodeIndex(node)).ToM4x4();
 
 		/*if (animationApplicants) {
 			F3 size = node->scale;
@@ -79,20 +78,22 @@ namespace MG {
 			
 			
 
+			// pbgɓ肫炸bViƂɃpbgւĕ`j
+			auto meshPartitions = model->meshPartitions.find(mesh);
+			bool partitioned = meshPartitions != model->meshPartitions.end();
+
 			if (mesh->boneNum > 0) {
 				ID3D11Buffer* boneWeightBuffer = model->boneWeightBuffers[mesh];
-				std::vector<MESH_BONE> meshBones(model->meshBones[mesh]);
-				for (int b = 0; b < mesh->boneNum; b++) {
-					meshBones[b].world = nodeWorldTransforms.at(meshBones[b].node);
+				if (!partitioned) {
+					SetSkinBones(model, pose, model->meshBones[mesh]);
 				}
 
 				UINT offset = 0;
 				UINT stride = sizeof(VERTEX_BONE_WEIGHT);
-				renderer->SetUseBone(true);
-				renderer->SetBones(meshBones.data(), meshBones.size());
+				renderer->SetUseBone(true, skinningMode);
 				context->IASetVertexBuffers(1, 1, &boneWeightBuffer, &stride, &offset);
 
-				M4x4 skinM4x4 = model->nodeWorldTransforms.at(node);
+				M4x4 skinM4x4 = model->bindPose.GetWorld(model->GetNodeIndex(node)).ToM4x4();
 				XMMATRIX skinMatrix = {
 					skinM4x4._v00, skinM4x4._v10, skinM4x4._v20, skinM4x4._v30,
 					skinM4x4._v01, skinM4x4._v11, skinM4x4._v21, skinM4x4._v31,
@@ -119,11 +120,41 @@ namespace MG {
 			ID3D11ShaderResourceView* resourceView = ((TextureDX*)texture)->resourceView;
 			context->PSSetShaderResources(0, 1, &resourceView);
 
+			if (partitioned) {
+				for (const MESH_PARTITION_DX& partition : meshPartitions->second) {
+					SetSkinBones(model, pose, partition.bones);
+
+					UINT strides[2] = { sizeof(VERTEX), sizeof(VERTEX_BONE_WEIGHT) };
+					UINT offsets[2] = { 0, 0 };
+					ID3D11Buffer* vertexBuffers[2] = { partition.vertexBuffer, partition.boneWeightBuffer };
+					context->IASetVertexBuffers(0, 2, vertexBuffers, strides, offsets);
+					context->IASetIndexBuffer(partition.indexBuffer, DXGI_FORMAT_R32_UINT, 0);
+					context->DrawIndexed(partition.vertexIndexNum, 0, 0);
+				}
+				continue;
+			}
+
 			context->DrawIndexed(mesh->vertexIndexNum, 0, 0);
 		}
 
 		for (int i = 0; i < node->childrenNum; i++) {
-			DrawModelNode(model, (node->children + i), nodeWorldTransforms);
+			DrawModelNode(model, (node->children + i), pose);
+		}
+	}
+
+	void DrawToolDX::SetSkinBones(const ModelDX* model, const Pose& pose, const std::vector<MESH_BONE>& bones)
+	{
+		if (skinningMode == SKINNING_MODE_DUAL_QUATERNION) {
+			// [gm[hŊgkO
+			const M3x4& space = pose.GetWorld(0);
+			drawDualQuaternionPalette.resize(bones.size());
+			BuildDualQuaternionPalette(model, pose, bones.data(), (unsigned int)bones.size(), space, drawDualQuaternionPalette.data());
+			renderer->SetDualQuaternionBones(drawDualQuaternionPalette.data(), drawDualQuaternionPalette.size(), space);
+		}
+		else {
+			drawPalette.resize(bones.size());
+			BuildSkinPalette(model, pose, bones.data(), (unsigned int)bones.size(), drawPalette.data());
+			renderer->SetBones(drawPalette.data(), drawPalette.size());
 		}
 	}
 
@@ -326,50 +357,46 @@ namespace MG {
 	void DrawToolDX::DrawModel(const Model* model, const F3& position, const F3& size, const Quaternion& rotate, const F4& color, const F2& uvOffset, const F2& uvRange)
 	{
 		ID3D11DeviceContext* context = renderer->GetDeviceContext();
-		M4x4 world = M4x4::ScalingMatrix(size) * M4x4::RotatingMatrix(rotate) * M4x4::TranslatingMatrix(position);
+		M4x4 world = M4x4::FromTRS(size, rotate, position);
 		renderer->SetColor(color);
 		renderer->SetUVOffset(uvOffset);
 		renderer->SetUVRange(uvRange);
 
 		ModelDX* modelDX = (ModelDX*)model;
 
-		std::map<MODEL_NODE*, M4x4> nodeWorldTransforms(modelDX->nodeWorldTransforms);
-
-		LoadNodeWorldTransforms(model->rawModel->rootNode, world, nodeWorldTransforms);
+		LoadNodeWorldTransforms(model, world, drawPose);
 
-		DrawModelNode(modelDX, model->rawModel->rootNode, nodeWorldTransforms);
+		DrawModelNode(modelDX, model->rawModel->rootNode, drawPose);
 	}
 
 	void DrawToolDX::DrawModel(const Model* model, const std::vector<ANIMATION_APPLICANT>& animationApplicants, const F3& position, const F3& size, const Quaternion& rotate, const F4& color)
 	{
 		ID3D11DeviceContext* context = renderer->GetDeviceContext();
-		M4x4 world = M4x4::ScalingMatrix(size) * M4x4::RotatingMatrix(rotate) * M4x4::TranslatingMatrix(position);
+		M4x4 world = M4x4::FromTRS(size, rotate, position);
 		renderer->SetColor(color);
 		renderer->SetUVOffset({});
 		renderer->SetUVRange({ 1.0f, 1.0f });
 
 		ModelDX* modelDX = (ModelDX*)model;
 
-		std::map<MODEL_NODE*, M4x4> nodeWorldTransforms(modelDX->nodeWorldTransforms);
-		LoadNodeWorldTransforms(model->rawModel->rootNode, world, nodeWorldTransforms, animationApplicants);
+		LoadNodeWorldTransforms(model, world, drawPose, animationApplicants);
 
-		DrawModelNode(modelDX, model->rawModel->rootNode, nodeWorldTransforms);
+		DrawModelNode(modelDX, model->rawModel->rootNode, drawPose);
 	}
 
 	void DrawToolDX::DrawModel(const Model* model, const std::vector<ANIMATION_APPLICANT>& animationApplicants0, const std::vector<ANIMATION_APPLICANT>& animationApplicants1, const float animTransitionT, const F3& position, const F3& size, const Quaternion& rotate, const F4& color)
 	{
 		ID3D11DeviceContext* context = renderer->GetDeviceContext();
-		M4x4 world = M4x4::ScalingMatrix(size) * M4x4::RotatingMatrix(rotate) * M4x4::TranslatingMatrix(position);
+		M4x4 world = M4x4::FromTRS(size, rotate, position);
 		renderer->SetColor(color);
 		renderer->SetUVOffset({});
 		renderer->SetUVRange({ 1.0f, 1.0f });
 
 		ModelDX* modelDX = (ModelDX*)model;
 
-		std::map<MODEL_NODE*, M4x4> nodeWorldTransforms(modelDX->nodeWorldTransforms);
-		LoadNodeWorldTransforms(model->rawModel->rootNode, world, nodeWorldTransforms, animationApplicants0, animationApplicants1, animTransitionT);
+		LoadNodeWorldTransforms(model, world, drawPose, animationApplicants0, animationApplicants1, animTransitionT);
 
-		DrawModelNode(modelDX, model->rawModel->rootNode, nodeWorldTransforms);
+		DrawModelNode(modelDX, model->rawModel->rootNode, drawPose);
 	}
 
 	void DrawToolDX::DrawModel(const Model* model, const std::map<MODEL_NODE*, M4x4>& transforms, const F4& color) {
@@ -377,7 +404,19 @@ namespace MG {
 		renderer->SetColor(color);
 		renderer->SetUVOffset({});
 		renderer->SetUVRange({ 1.0f, 1.0f });
-		DrawModelNode(modelDX, model->rawModel->rootNode, transforms);
+
+		// pobt@ɈڂĂ`
+		drawPose = modelDX->bindPose;
+		drawPose.CopyFrom(model->rawModel->rootNode, transforms);
+		DrawModelNode(modelDX, model->rawModel->rootNode, drawPose);
+	}
+
+	void DrawToolDX::DrawModel(const Model* model, const Pose& pose, const F4& color) {
+		ModelDX* modelDX = (ModelDX*)model;
+		renderer->SetColor(color);
+		renderer->SetUVOffset({});
+		renderer->SetUVRange({ 1.0f, 1.0f });
+		DrawModelNode(modelDX, model->rawModel->rootNode, pose);
 	}
 
 	void DrawToolDX::DrawPolygon(const Texture* texture, const VERTEX* vertices, size_t length, TOPOLOGY topology, const F3& position, const F3& size, const Quaternion& rotate, const F4& color, const F2& uvOffset, const F2& uvRange)
@@ -458,4 +497,14 @@ namespace MG {
 		//renderer->SetRasterizerState(RASTERIZER_STATE_CULL_NONE);
 	}
 
+	void DrawToolDX::SetSkinningMode(SKINNING_MODE mode)
+	{
+		skinningMode = mode;
+	}
+
+	SKINNING_MODE DrawToolDX::GetSkinningMode() const
+	{
+		return skinningMode;
+	}
+
 } // namespace MG
\ No newline at end of file
@@ -19,8 +19,13 @@ namespace MG {
 	class DrawToolDX : public DrawTool {
 	protected:
 		RendererDX* renderer;
+		Pose drawPose;						// `p̎pAg
+		std::vector<M3x4> drawPalette;		// XLpbg̍Ɨ̈Ag
+		std::vector<DUAL_QUATERNION> drawDualQuaternionPalette;	// fANH[^jI
+		SKINNING_MODE skinningMode = SKINNING_MODE_LINEAR;
 		//void DrawModelNode(ModelDX* model, const MODEL_NODE* node, const XMMATRIX& world, const std::vector<ANIMATION_APPLICANT>& animationApplicants = {});
-		void DrawModelNode(ModelDX* model, MODEL_NODE* const node, const std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms);
+		void DrawModelNode(ModelDX* model, MODEL_NODE* const node, const Pose& pose);
+		void SetSkinBones(const ModelDX* model, const Pose& pose, const std::vector<MESH_BONE>& bones);
 	public:
 		DrawToolDX(RendererDX* renderer);
 		~DrawToolDX();
@@ -30,9 +35,12 @@ namespace MG {
 		void DrawModel(const Model* model, const std::vector<ANIMATION_APPLICANT>& animationApplicants, const F3& position, const F3& size, const Quaternion& rotate, const F4& color) override;
 		void DrawModel(const Model* model, const std::vector<ANIMATION_APPLICANT>& animationApplicants0, const std::vector<ANIMATION_APPLICANT>& animationApplicants1, const float animTransitionT, const F3& position, const F3& size, const Quaternion& rotate, const F4& color) override;
 		void DrawModel(const Model* model, const std::map<MODEL_NODE*, M4x4>& transforms, const F4& color) override;
+		void DrawModel(const Model* model, const Pose& pose, const F4& color) override;
 		
 		void DrawPolygon(const Texture* texture, const VERTEX* vertices, size_t length, TOPOLOGY topology, const F3& position, const F3& size, const Quaternion& rotate, const F4& color, const F2& uvOffset, const F2& uvRange) override;
 		void DrawCube(const M4x4& matrix, const F4& color = { 1.0f, 1.0f, 1.0f, 1.0f }) override;
+		void SetSkinningMode(SKINNING_MODE mode) override;
+		SKINNING_MODE GetSkinningMode() const override;
 	};
 
 } // namespace MG
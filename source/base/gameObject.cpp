@@ -108,7 +108,7 @@ namespace MG {
 				}
 				CollisionUnit* collisionUnit = CollisionUnit::Create(
 					type,
-					M4x4::ScalingMatrix(instance.scale) * M4x4::RotatingMatrix(instance.rotate) * M4x4::TranslatingMatrix(instance.position),
+					M4x4::FromTRS(instance.scale, instance.rotate, instance.position),
 					instance.name
 				);
 				collisionUnits.push_back({
@@ -143,7 +143,7 @@ namespace MG {
 	void GameObject::UpdateWorldCollisionUnits()
 	{
 
-		M4x4 world = M4x4::ScalingMatrix(size) * M4x4::RotatingMatrix(rotate)* M4x4::TranslatingMatrix(position);
+		M4x4 world = M4x4::FromTRS(size, rotate, position);
 		for (COLLISION_UNIT& collisionUnit : collisionUnits) {
 			delete collisionUnit.world;
 			collisionUnit.world = CollisionUnit::Create(collisionUnit.local);
@@ -0,0 +1,208 @@
+// =======================================================
+// inertialization.cpp
+//
+// ԂɂAj[VJ
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "inertialization.h"
+#include "resourceTool.h"
+
+namespace MG {
+
+	// =======================================================
+	// Ȑ̍쐬
+	// x0Ƒxv0AdurationɒlExEx0ɂȂ܎
+	// L̑x͎̂ĂāAI[o[V[gȂ悤durationk߂
+	// =======================================================
+	static INERTIALIZATION_CURVE CreateCurve(const F3& offset, const F3& velocity, float duration)
+	{
+		INERTIALIZATION_CURVE curve;
+		float x0 = sqrtf(Dot(offset, offset));
+		if (x0 <= 0.0f || duration <= 0.0f) {
+			return curve;
+		}
+		F3 axis = offset / x0;
+		float v0 = Dot(velocity, axis);
+		if (v0 > 0.0f) {
+			v0 = 0.0f;
+		}
+
+		float tf = duration;
+		if (v0 < 0.0f) {
+			tf = std::min(tf, -5.0f * x0 / v0);
+		}
+		float tf2 = tf * tf;
+		float a0 = std::max(0.0f, (-8.0f * v0 * tf - 20.0f * x0) / tf2);
+
+		curve.axis = axis;
+		curve.x0 = x0;
+		curve.v0 = v0;
+		curve.A = -(a0 * tf2 + 6.0f * v0 * tf + 12.0f * x0) / (2.0f * tf2 * tf2 * tf);
+		curve.B = (3.0f * a0 * tf2 + 16.0f * v0 * tf + 30.0f * x0) / (2.0f * tf2 * tf2);
+		curve.C = -(3.0f * a0 * tf2 + 12.0f * v0 * tf + 20.0f * x0) / (2.0f * tf2 * tf);
+		curve.D = 0.5f * a0;	// x''(0) = 2D = a0
+		curve.duration = tf;
+		return curve;
+	}
+
+	static float EvaluateCurve(const INERTIALIZATION_CURVE& curve, float t)
+	{
+		if (t >= curve.duration) {
+			return 0.0f;
+		}
+		return ((((curve.A * t + curve.B) * t + curve.C) * t + curve.D) * t + curve.v0) * t + curve.x0;
+	}
+
+	// ]]~pxiWAjɕϊ
+	static F3 ToRotationVector(Quaternion q)
+	{
+		if (q.w < 0.0f) {
+			q = { -q.x, -q.y, -q.z, -q.w };
+		}
+		F3 v = { q.x, q.y, q.z };
+		float s = sqrtf(Dot(v, v));
+		if (s <= 0.0f) {
+			return { 0.0f, 0.0f, 0.0f };
+		}
+		return v * (2.0f * atan2f(s, q.w) / s);
+	}
+
+
+	// =======================================================
+	// Inertialization
+	// =======================================================
+	Inertialization::Inertialization(float duration) :
+		duration(duration)
+	{
+	}
+
+	bool Inertialization::IsStarted() const
+	{
+		return started;
+	}
+
+	bool Inertialization::IsFinished() const
+	{
+		return started && elapsed >= duration;
+	}
+
+	void Inertialization::Reset()
+	{
+		started = false;
+		elapsed = 0.0f;
+	}
+
+	void Inertialization::Reset(float duration)
+	{
+		this->duration = duration;
+		Reset();
+	}
+
+	// ]ɊmۂȂ悤ɁAɃm[hmۂĂ
+	void Inertialization::Reserve(unsigned int nodeNum)
+	{
+		offsets.resize(nodeNum);
+		sourcePose.Resize(nodeNum);
+	}
+
+	// =======================================================
+	// JڊJn
+	// Jڌ̎pƈÕt[瑬x߁AJڐƂ̍L^
+	// previousSourcePosẽm[hȂΑx0Ƃ݂Ȃ
+	// =======================================================
+	void Inertialization::Start(const Model* model, const Pose& sourcePose, const Pose& previousSourcePose, float deltaTime, const Pose& destinationPose)
+	{
+		started = true;
+		elapsed = 0.0f;
+		offsets.resize(model->nodeNum);
+		if (sourcePose.GetNodeNum() != model->nodeNum || destinationPose.GetNodeNum() != model->nodeNum) {
+			offsets.assign(model->nodeNum, {});
+			return;
+		}
+
+		bool hasVelocity = previousSourcePose.GetNodeNum() == model->nodeNum && deltaTime > 0.0f;
+		float invDeltaTime = hasVelocity ? 1.0f / deltaTime : 0.0f;
+		const NODE_TRANSFORM* sources = sourcePose.GetLocals();
+		const NODE_TRANSFORM* previousSources = previousSourcePose.GetLocals();
+		const NODE_TRANSFORM* destinations = destinationPose.GetLocals();
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			const NODE_TRANSFORM& source = sources[i];
+			const NODE_TRANSFORM& destination = destinations[i];
+			F3 scaleVelocity = {};
+			F3 positionVelocity = {};
+			F3 rotateVelocity = {};
+			if (hasVelocity) {
+				const NODE_TRANSFORM& previous = previousSources[i];
+				scaleVelocity = (source.scale - previous.scale) * invDeltaTime;
+				positionVelocity = (source.position - previous.position) * invDeltaTime;
+				rotateVelocity = ToRotationVector(source.rotate * previous.rotate.Inverse()) * invDeltaTime;
+			}
+			offsets[i].scale = CreateCurve(source.scale - destination.scale, scaleVelocity, duration);
+			offsets[i].position = CreateCurve(source.position - destination.position, positionVelocity, duration);
+			offsets[i].rotate = CreateCurve(ToRotationVector(source.rotate * destination.rotate.Inverse()), rotateVelocity, duration);
+		}
+	}
+
+	// =======================================================
+	// Jڐ̎pɍ𑫂āAԂi߂
+	// poseL^̃m[hfƍȂ΁A͑Ȃ
+	// =======================================================
+	void Inertialization::Apply(const Model* model, Pose& pose, float deltaTime)
+	{
+		if (!started || elapsed >= duration) {
+			return;
+		}
+		if (pose.GetNodeNum() != model->nodeNum || offsets.size() != model->nodeNum) {
+			elapsed += deltaTime;
+			return;
+		}
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		unsigned int nodeNum = model->nodeNum;
+		for (unsigned int i = 0; i < nodeNum; i++) {
+			const INERTIALIZATION_OFFSET& offset = offsets[i];
+			if (offset.scale.duration > elapsed) {
+				locals[i].scale += offset.scale.axis * EvaluateCurve(offset.scale, elapsed);
+			}
+			if (offset.position.duration > elapsed) {
+				locals[i].position += offset.position.axis * EvaluateCurve(offset.position, elapsed);
+			}
+			if (offset.rotate.duration > elapsed) {
+				locals[i].rotate = Normalize(Quaternion::AxisRadian(offset.rotate.axis, EvaluateCurve(offset.rotate, elapsed)) * locals[i].rotate);
+			}
+		}
+		elapsed += deltaTime;
+	}
+
+
+	// =======================================================
+	// ԂőJڂȂ烍[Jϊǂݍ
+	// ŏ̌ĂяoŁAposeɎcĂOt[̌ʂJڌA
+	// previousPosëÕt[ƂċL^
+	// previousPose͖Ot[̌ʂɍXV̂ŁȂJڂł̂܂ܓn
+	// =======================================================
+	void Inertialization::Evaluate(const Model* model, Pose& pose, Pose& previousPose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime)
+	{
+		sourcePose = pose;
+		LoadNodeLocalTransforms(model, pose, animationApplicants);
+		if (!started) {
+			Start(model, sourcePose, previousPose, deltaTime, pose);
+		}
+		Apply(model, pose, deltaTime);
+		std::swap(previousPose, sourcePose);
+	}
+
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, Inertialization& inertialization, Pose& previousPose,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime)
+	{
+		inertialization.Evaluate(model, pose, previousPose, animationApplicants, deltaTime);
+	}
+
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, Inertialization& inertialization, Pose& previousPose,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime)
+	{
+		LoadNodeLocalTransforms(model, pose, inertialization, previousPose, animationApplicants, deltaTime);
+		UpdateNodeWorldTransforms(model, worldTransform, pose);
+	}
+
+} // namespace MG
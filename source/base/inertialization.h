@@ -0,0 +1,72 @@
+// =======================================================
+// inertialization.h
+//
+// ԂɂAj[VJ
+// ؂ւuԂɑJڌƂ̍Ƒxm[hƂɋL^A
+// ȍ~͑Jڐ悾]āA鑽̍𑫂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _INERTIALIZATION_H
+#define _INERTIALIZATION_H
+
+#include "pose.h"
+
+namespace MG {
+
+	// {̌Ȑ
+	// x(t) = A t^5 + B t^4 + C t^3 + D t^2 + v0 t + x0it >= durationȂ0j
+	struct INERTIALIZATION_CURVE {
+		F3 axis;
+		float x0 = 0.0f;
+		float v0 = 0.0f;
+		float A = 0.0f;
+		float B = 0.0f;
+		float C = 0.0f;
+		float D = 0.0f;
+		float duration = 0.0f;
+	};
+
+	// m[hƂ̍
+	struct INERTIALIZATION_OFFSET {
+		INERTIALIZATION_CURVE scale;
+		INERTIALIZATION_CURVE rotate;
+		INERTIALIZATION_CURVE position;
+	};
+
+	// =======================================================
+	// Ԃ̏
+	//
+	// JڂƂɈAŏ̕]őJڌL^
+	// Ԃ̒PʂGetDeltaTimeƓi~bj
+	// =======================================================
+	class Inertialization {
+	private:
+		std::vector<INERTIALIZATION_OFFSET> offsets;
+		float duration;
+		float elapsed = 0.0f;
+		bool started = false;
+		Pose sourcePose;	// Ot[̌ʂ̑ޔig񂷁j
+	public:
+		Inertialization(float duration = 300.0f);
+		bool IsStarted() const;
+		bool IsFinished() const;
+		void Reset();
+		void Reset(float duration);
+		void Reserve(unsigned int nodeNum);
+		void Start(const Model* model, const Pose& sourcePose, const Pose& previousSourcePose, float deltaTime, const Pose& destinationPose);
+		void Apply(const Model* model, Pose& pose, float deltaTime);
+		void Evaluate(const Model* model, Pose& pose, Pose& previousPose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime);
+	};
+
+	// Jڂ̐`ԔLoadNodeLocalTransforms/LoadNodeWorldTransforms̒u
+	// JڌƑJڐ𗼕]AJڐ悾]č𑫂
+	// pose͑Ot[̌ʁiJڌjApreviousPose͂̈Õt[iĂяoƂɍXVj
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, Inertialization& inertialization, Pose& previousPose,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime);
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, Inertialization& inertialization, Pose& previousPose,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants, float deltaTime);
+
+} // namespace MG
+
+#endif
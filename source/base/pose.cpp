@@ -0,0 +1,680 @@
+// =======================================================
+// pose.cpp
+// 
+// f̎p
+// 
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "pose.h"
+#include "resourceTool.h"
+#include "animationKernel.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MG {
+
+	Pose::Pose(unsigned int nodeNum)
+	{
+		Resize(nodeNum);
+	}
+
+	void Pose::Resize(unsigned int nodeNum)
+	{
+		if (locals.size() != nodeNum) {
+			locals.resize(nodeNum);
+			worlds.resize(nodeNum);
+		}
+	}
+
+	unsigned int Pose::GetNodeNum() const
+	{
+		return (unsigned int)locals.size();
+	}
+
+	NODE_TRANSFORM* Pose::GetLocals()
+	{
+		return locals.data();
+	}
+
+	const NODE_TRANSFORM* Pose::GetLocals() const
+	{
+		return locals.data();
+	}
+
+	M3x4* Pose::GetWorlds()
+	{
+		return worlds.data();
+	}
+
+	const M3x4* Pose::GetWorlds() const
+	{
+		return worlds.data();
+	}
+
+	const M3x4& Pose::GetWorld(unsigned int nodeIndex) const
+	{
+		return worlds[nodeIndex];
+	}
+
+
+	// =======================================================
+	// std::mapƂ̕ϊiC^[tF[Xpj
+	// =======================================================
+	void Pose::CopyFrom(const MODEL_NODE* rootNode, const std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms)
+	{
+		for (const auto& pair : nodeWorldTransforms) {
+			unsigned int nodeIndex = (unsigned int)(pair.first - rootNode);
+			if (nodeIndex < worlds.size()) {
+				worlds[nodeIndex] = M3x4::FromM4x4(pair.second);
+			}
+		}
+	}
+
+	static void CopyWorldTransforms(MODEL_NODE* rootNode, MODEL_NODE* currentNode, const M3x4* worlds, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms)
+	{
+		nodeWorldTransforms[currentNode] = worlds[currentNode - rootNode].ToM4x4();
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			CopyWorldTransforms(rootNode, currentNode->children + i, worlds, nodeWorldTransforms);
+		}
+	}
+
+	void Pose::CopyTo(MODEL_NODE* rootNode, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms) const
+	{
+		CopyWorldTransforms(rootNode, rootNode, worlds.data(), nodeWorldTransforms);
+	}
+
+
+	// =======================================================
+	// {[}XN
+	// =======================================================
+	static constexpr unsigned int BONE_MASK_WORD_BITS = 32;
+
+	BoneMask::BoneMask(unsigned int nodeNum)
+	{
+		Resize(nodeNum);
+	}
+
+	void BoneMask::Resize(unsigned int nodeNum)
+	{
+		this->nodeNum = nodeNum;
+		bits.resize((nodeNum + BONE_MASK_WORD_BITS - 1) / BONE_MASK_WORD_BITS, 0);
+	}
+
+	unsigned int BoneMask::GetNodeNum() const
+	{
+		return nodeNum;
+	}
+
+	unsigned int BoneMask::GetWordNum() const
+	{
+		return (unsigned int)bits.size();
+	}
+
+	const unsigned int* BoneMask::GetWords() const
+	{
+		return bits.data();
+	}
+
+	bool BoneMask::Test(unsigned int nodeIndex) const
+	{
+		if (nodeIndex >= nodeNum) {
+			return false;
+		}
+		return (bits[nodeIndex / BONE_MASK_WORD_BITS] >> (nodeIndex % BONE_MASK_WORD_BITS)) & 1u;
+	}
+
+	void BoneMask::Set(unsigned int nodeIndex, bool enable)
+	{
+		if (nodeIndex >= nodeNum) {
+			Resize(nodeIndex + 1);
+		}
+		unsigned int bit = 1u << (nodeIndex % BONE_MASK_WORD_BITS);
+		if (enable) {
+			bits[nodeIndex / BONE_MASK_WORD_BITS] |= bit;
+		}
+		else {
+			bits[nodeIndex / BONE_MASK_WORD_BITS] &= ~bit;
+		}
+	}
+
+	void BoneMask::SetAll(bool enable)
+	{
+		for (unsigned int i = 0; i < nodeNum; i++) {
+			Set(i, enable);
+		}
+	}
+
+	void BoneMask::SetNode(const Model* model, const MODEL_NODE* node, bool withChildren, bool enable)
+	{
+		Resize(model->nodeNum);
+		Set(model->GetNodeIndex(node), enable);
+		if (withChildren) {
+			for (unsigned int i = 0; i < node->childrenNum; i++) {
+				SetNode(model, node->children + i, true, enable);
+			}
+		}
+	}
+
+	// Aj[V`lm[h
+	void BoneMask::SetBinding(const AnimationBinding* binding, bool enable)
+	{
+		unsigned int num = binding->GetModel()->nodeNum;
+		Resize(num);
+		for (unsigned int i = 0; i < num; i++) {
+			if (binding->GetChannelIndex(i) != ANIMATION_BINDING_NONE) {
+				Set(i, enable);
+			}
+		}
+	}
+
+	// Ăԉ̃rbg̈ʒu
+	static unsigned int LowestBit(unsigned int word)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, word);
+		return (unsigned int)index;
+#else
+		return (unsigned int)__builtin_ctz(word);
+#endif
+	}
+
+
+	// =======================================================
+	// m[hȉŎgm[hԍ͈̔́iőԍ+1j
+	// [gm[hȂSm[hƓ
+	// =======================================================
+	static unsigned int GetNodeIndexRange(const MODEL_NODE* rootNode, const MODEL_NODE* currentNode)
+	{
+		unsigned int range = (unsigned int)(currentNode - rootNode) + 1;
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			range = std::max(range, GetNodeIndexRange(rootNode, currentNode->children + i));
+		}
+		return range;
+	}
+
+
+	// =======================================================
+	// m[hɑΉ`lԍ擾
+	// }XNŊOꂽm[h̓`lȂ
+	// oCfBOΐ̎QƂAȂ΃m[hŌ
+	// =======================================================
+	static unsigned int GetApplicantChannel(const ANIMATION_APPLICANT& applicant, const MODEL_NODE* node, unsigned int nodeIndex)
+	{
+		if (applicant.mask && !applicant.mask->Test(nodeIndex)) {
+			return ANIMATION_BINDING_NONE;
+		}
+		if (applicant.binding) {
+			return applicant.binding->GetChannelIndex(node);
+		}
+		auto itr = applicant.animation->modelNodeChannels.find(node->name);
+		if (itr != applicant.animation->modelNodeChannels.end()) {
+			return (unsigned int)(itr->second - applicant.animation->rawAnimation->channels);
+		}
+		return ANIMATION_BINDING_NONE;
+	}
+
+	static NODE_TRANSFORM GetBindTransform(const MODEL_NODE* node)
+	{
+		return {
+			node->scale,
+			{ node->rotate.x, node->rotate.y, node->rotate.z, node->rotate.w },
+			node->position
+		};
+	}
+
+	static void ApplyApplicants(const std::vector<ANIMATION_APPLICANT>& animationApplicants, const MODEL_NODE* node, unsigned int nodeIndex, NODE_TRANSFORM& transform)
+	{
+		for (const ANIMATION_APPLICANT& applicant : animationApplicants) {
+			unsigned int channelIndex = GetApplicantChannel(applicant, node, nodeIndex);
+			if (channelIndex != ANIMATION_BINDING_NONE) {
+				applicant.animation->ApplyChannel(channelIndex, applicant.currentFrame, &transform.scale, &transform.position, &transform.rotate, applicant.cursor);
+				break;
+			}
+		}
+	}
+
+
+	// ̃Aj[VZbg`
+	static NODE_TRANSFORM GetBlendTransform(const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t, const MODEL_NODE* node, unsigned int nodeIndex)
+	{
+		NODE_TRANSFORM transform0 = GetBindTransform(node);
+		NODE_TRANSFORM transform1 = transform0;
+		ApplyApplicants(animationSet0, node, nodeIndex, transform0);
+		ApplyApplicants(animationSet1, node, nodeIndex, transform1);
+		return {
+			Lerp(transform0.scale, transform1.scale, t),
+			BlendQuaternion(transform0.rotate, transform1.rotate, t),
+			Lerp(transform0.position, transform1.position, t)
+		};
+	}
+
+
+	// =======================================================
+	// [Jϊ̓ǂݍ݁im[hċAłǂj
+	// rootNodëʒum[hԍƂď
+	// =======================================================
+	static void LoadLocalTransforms(MODEL_NODE* rootNode, MODEL_NODE* currentNode, NODE_TRANSFORM* locals)
+	{
+		locals[currentNode - rootNode] = GetBindTransform(currentNode);
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			LoadLocalTransforms(rootNode, currentNode->children + i, locals);
+		}
+	}
+
+	static void LoadLocalTransforms(MODEL_NODE* rootNode, MODEL_NODE* currentNode, NODE_TRANSFORM* locals,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants)
+	{
+		NODE_TRANSFORM& transform = locals[currentNode - rootNode];
+		transform = GetBindTransform(currentNode);
+		ApplyApplicants(animationApplicants, currentNode, (unsigned int)(currentNode - rootNode), transform);
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			LoadLocalTransforms(rootNode, currentNode->children + i, locals, animationApplicants);
+		}
+	}
+
+	static void LoadLocalTransforms(MODEL_NODE* rootNode, MODEL_NODE* currentNode, NODE_TRANSFORM* locals,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t)
+	{
+		locals[currentNode - rootNode] = GetBlendTransform(animationSet0, animationSet1, t, currentNode, (unsigned int)(currentNode - rootNode));
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			LoadLocalTransforms(rootNode, currentNode->children + i, locals, animationSet0, animationSet1, t);
+		}
+	}
+
+	// =======================================================
+	// [Jϊ烏[hs߂im[hċAłǂj
+	// em[hԍ̕\Ȃstd::mapłŎg
+	// =======================================================
+	static void UpdateWorldTransforms(MODEL_NODE* rootNode, MODEL_NODE* currentNode, const M3x4& worldTransform, const NODE_TRANSFORM* locals, M3x4* worlds)
+	{
+		unsigned int nodeIndex = (unsigned int)(currentNode - rootNode);
+		const NODE_TRANSFORM& local = locals[nodeIndex];
+		worlds[nodeIndex] = M3x4::FromTRS(local.scale, local.rotate, local.position, worldTransform);
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			UpdateWorldTransforms(rootNode, currentNode->children + i, worlds[nodeIndex], locals, worlds);
+		}
+	}
+
+
+	// =======================================================
+	// [Jϊ̓ǂݍ݁im[hԍj
+	// =======================================================
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose)
+	{
+		pose.Resize(model->nodeNum);
+		const MODEL_NODE* nodes = model->rawModel->rootNode;
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			locals[i] = GetBindTransform(nodes + i);
+		}
+	}
+
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants)
+	{
+		pose.Resize(model->nodeNum);
+		const MODEL_NODE* nodes = model->rawModel->rootNode;
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			locals[i] = GetBindTransform(nodes + i);
+			ApplyApplicants(animationApplicants, nodes + i, i, locals[i]);
+		}
+	}
+
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, const BoneMask& updateMask)
+	{
+		pose.Resize(model->nodeNum);
+		const MODEL_NODE* nodes = model->rawModel->rootNode;
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			if (!updateMask.Test(i)) {
+				continue;
+			}
+			locals[i] = GetBindTransform(nodes + i);
+			ApplyApplicants(animationApplicants, nodes + i, i, locals[i]);
+		}
+	}
+
+	// =======================================================
+	// ̎p̃[JϊԁiSIMDob`j
+	// 
+	// Ƃ̔zɕבւāAgƈʒuLerpBatchA
+	// ]GetQuaternionBlendModeɍ킹NlerpBatch / FastSlerpBatch / SlerpBatch
+	// Ɨp̔z̓XbhƂɎ񂷁iQO̕]Ă΂Ăj
+	// =======================================================
+	struct POSE_BLEND_WORKSPACE {
+		std::vector<float> floats;
+		Pose pose;
+	};
+
+	static POSE_BLEND_WORKSPACE& GetPoseBlendWorkspace()
+	{
+		static thread_local POSE_BLEND_WORKSPACE workspace;
+		return workspace;
+	}
+
+	void BlendPoses(const Pose& pose0, const Pose& pose1, float t, Pose& out)
+	{
+		const unsigned int nodeNum = std::min(pose0.GetNodeNum(), pose1.GetNodeNum());
+		std::vector<float>& floats = GetPoseBlendWorkspace().floats;
+		floats.resize((size_t)nodeNum * 21);
+		float* current = floats.data();
+		auto allocate = [&current, nodeNum]() {
+			float* array = current;
+			current += nodeNum;
+			return array;
+		};
+		F3_SOA scale0 = { allocate(), allocate(), allocate() };
+		F3_SOA scale1 = { allocate(), allocate(), allocate() };
+		F3_SOA position0 = { allocate(), allocate(), allocate() };
+		F3_SOA position1 = { allocate(), allocate(), allocate() };
+		QUATERNION_SOA rotate0 = { allocate(), allocate(), allocate(), allocate() };
+		QUATERNION_SOA rotate1 = { allocate(), allocate(), allocate(), allocate() };
+		float* ts = allocate();
+
+		auto gather = [nodeNum](const NODE_TRANSFORM* locals, const F3_SOA& scale, const F3_SOA& position, const QUATERNION_SOA& rotate) {
+			for (unsigned int i = 0; i < nodeNum; i++) {
+				scale.x[i] = locals[i].scale.x;
+				scale.y[i] = locals[i].scale.y;
+				scale.z[i] = locals[i].scale.z;
+				position.x[i] = locals[i].position.x;
+				position.y[i] = locals[i].position.y;
+				position.z[i] = locals[i].position.z;
+				rotate.x[i] = locals[i].rotate.x;
+				rotate.y[i] = locals[i].rotate.y;
+				rotate.z[i] = locals[i].rotate.z;
+				rotate.w[i] = locals[i].rotate.w;
+			}
+		};
+		gather(pose0.GetLocals(), scale0, position0, rotate0);
+		gather(pose1.GetLocals(), scale1, position1, rotate1);
+		std::fill(ts, ts + nodeNum, t);
+
+		// ʂ0̔zɏ
+		LerpBatch(scale0, scale1, ts, scale0, nodeNum);
+		LerpBatch(position0, position1, ts, position0, nodeNum);
+		switch (GetQuaternionBlendMode()) {
+		case QUATERNION_BLEND_FAST_SLERP:
+			FastSlerpBatch(rotate0, rotate1, ts, rotate0, nodeNum);
+			break;
+		case QUATERNION_BLEND_SLERP:
+			SlerpBatch(rotate0, rotate1, ts, rotate0, nodeNum);
+			break;
+		default:
+			NlerpBatch(rotate0, rotate1, ts, rotate0, nodeNum);
+			break;
+		}
+
+		out.Resize(nodeNum);
+		NODE_TRANSFORM* locals = out.GetLocals();
+		for (unsigned int i = 0; i < nodeNum; i++) {
+			locals[i].scale = { scale0.x[i], scale0.y[i], scale0.z[i] };
+			locals[i].position = { position0.x[i], position0.y[i], position0.z[i] };
+			locals[i].rotate = { rotate0.x[i], rotate0.y[i], rotate0.z[i], rotate0.w[i] };
+		}
+	}
+
+	// ̃Aj[VZbgꂼ]ĂApBlendPosesŕ
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t)
+	{
+		Pose& pose1 = GetPoseBlendWorkspace().pose;
+		LoadNodeLocalTransforms(model, pose, animationSet0);
+		LoadNodeLocalTransforms(model, pose1, animationSet1);
+		BlendPoses(pose, pose1, t, pose);
+	}
+
+	// =======================================================
+	// N̃Aj[VdݕtŃuh
+	// 
+	// m[hƂɈ񂾂āA`lAj[V
+	// TvOėݐςiq̌Ăяo͕svj
+	// ]͍ŏ̃TvƓɑĉZAŌɐK
+	// =======================================================
+	struct BLEND_ACCUMULATOR {
+		F3 scale = {};
+		F3 position = {};
+		Quaternion rotate = { 0.0f, 0.0f, 0.0f, 0.0f };
+		Quaternion reference = {};
+		float weight = 0.0f;
+
+		void Add(const NODE_TRANSFORM& transform, float w)
+		{
+			if (weight <= 0.0f) {
+				reference = transform.rotate;
+			}
+			float sign = (Dot(reference, transform.rotate) < 0.0f) ? -w : w;
+			scale += transform.scale * w;
+			position += transform.position * w;
+			rotate.x += transform.rotate.x * sign;
+			rotate.y += transform.rotate.y * sign;
+			rotate.z += transform.rotate.z * sign;
+			rotate.w += transform.rotate.w * sign;
+			weight += w;
+		}
+	};
+
+	void BlendNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, ANIMATION_BLEND_NORMALIZE normalize)
+	{
+		pose.Resize(model->nodeNum);
+		const MODEL_NODE* nodes = model->rawModel->rootNode;
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			NODE_TRANSFORM bind = GetBindTransform(nodes + i);
+			BLEND_ACCUMULATOR accumulator;
+			for (const ANIMATION_APPLICANT& applicant : animationApplicants) {
+				if (applicant.weight <= 0.0f) {
+					continue;
+				}
+				unsigned int channelIndex = GetApplicantChannel(applicant, nodes + i, i);
+				if (channelIndex == ANIMATION_BINDING_NONE) {
+					continue;
+				}
+				NODE_TRANSFORM sample = bind;
+				applicant.animation->ApplyChannel(channelIndex, applicant.currentFrame, &sample.scale, &sample.position, &sample.rotate, applicant.cursor);
+				accumulator.Add(sample, applicant.weight);
+			}
+
+			if (accumulator.weight <= 0.0f) {
+				locals[i] = bind;
+				continue;
+			}
+
+			float total = 1.0f;
+			if (normalize == ANIMATION_BLEND_NORMALIZE_BIND_POSE) {
+				if (accumulator.weight < 1.0f) {
+					accumulator.Add(bind, 1.0f - accumulator.weight);
+				}
+				total = accumulator.weight;
+			}
+			else if (normalize == ANIMATION_BLEND_NORMALIZE_NODE) {
+				total = accumulator.weight;
+			}
+
+			locals[i].scale = accumulator.scale / total;
+			locals[i].position = accumulator.position / total;
+			locals[i].rotate = Normalize(accumulator.rotate);
+		}
+	}
+
+	void BlendNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, ANIMATION_BLEND_NORMALIZE normalize)
+	{
+		BlendNodeLocalTransforms(model, pose, animationApplicants, normalize);
+		UpdateNodeWorldTransforms(model, worldTransform, pose);
+	}
+
+
+	// Ƃ̊g̔A0͍̎Ȃi1j
+	static float GetScaleDelta(float sample, float reference)
+	{
+		return (reference != 0.0f) ? sample / reference : 1.0f;
+	}
+
+
+	// =======================================================
+	// C[d˂
+	// 
+	// ̎piLoadNodeLocalTransformsȂǂ̌ʁj̏ɏԂɓKp
+	// OVERRIDEFTv֏d݂ŕ
+	// ADDITIVEFreferenceFrameƂ̍dݕ
+	// }XNΗĂrbg̃m[ĥŁA
+	// 炾̃C[Ȃ琔{̃gbNTvOȂ
+	// =======================================================
+	static void ApplyLayer(const ANIMATION_APPLICANT& layer, const MODEL_NODE* node, unsigned int channelIndex, NODE_TRANSFORM& transform)
+	{
+		NODE_TRANSFORM sample = GetBindTransform(node);
+		NODE_TRANSFORM reference = sample;
+		layer.animation->ApplyChannel(channelIndex, layer.currentFrame, &sample.scale, &sample.position, &sample.rotate, layer.cursor);
+
+		if (layer.layer == ANIMATION_LAYER_OVERRIDE) {
+			if (layer.weight >= 1.0f) {
+				transform = sample;
+				return;
+			}
+			transform.scale = Lerp(transform.scale, sample.scale, layer.weight);
+			transform.rotate = BlendQuaternion(transform.rotate, sample.rotate, layer.weight);
+			transform.position = Lerp(transform.position, sample.position, layer.weight);
+			return;
+		}
+
+		// t[̓J[\gȂiĐʒũJ[\𗐂Ȃ߁j
+		layer.animation->ApplyChannel(channelIndex, layer.referenceFrame, &reference.scale, &reference.position, &reference.rotate, nullptr);
+
+		Quaternion delta = reference.rotate.Inverse() * sample.rotate;
+		if (delta.w < 0.0f) {
+			delta = { -delta.x, -delta.y, -delta.z, -delta.w };
+		}
+		F3 scaleDelta = {
+			GetScaleDelta(sample.scale.x, reference.scale.x),
+			GetScaleDelta(sample.scale.y, reference.scale.y),
+			GetScaleDelta(sample.scale.z, reference.scale.z)
+		};
+		if (layer.weight < 1.0f) {
+			delta = BlendQuaternion(Quaternion::Identity(), delta, layer.weight);
+			scaleDelta = Lerp(F3{ 1.0f, 1.0f, 1.0f }, scaleDelta, layer.weight);
+		}
+		transform.scale *= scaleDelta;
+		transform.rotate = Normalize(transform.rotate * delta);
+		transform.position += (sample.position - reference.position) * layer.weight;
+	}
+
+	void ApplyNodeLayers(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationLayers)
+	{
+		const MODEL_NODE* nodes = model->rawModel->rootNode;
+		NODE_TRANSFORM* locals = pose.GetLocals();
+		unsigned int nodeNum = std::min(model->nodeNum, pose.GetNodeNum());
+		for (const ANIMATION_APPLICANT& layer : animationLayers) {
+			if (layer.weight <= 0.0f) {
+				continue;
+			}
+
+			if (layer.mask) {
+				// Ărbgǂ
+				const unsigned int* words = layer.mask->GetWords();
+				for (unsigned int w = 0; w < layer.mask->GetWordNum(); w++) {
+					unsigned int word = words[w];
+					while (word) {
+						unsigned int i = w * BONE_MASK_WORD_BITS + LowestBit(word);
+						word &= word - 1;
+						if (i >= nodeNum) {
+							break;
+						}
+						unsigned int channelIndex = GetApplicantChannel(layer, nodes + i, i);
+						if (channelIndex != ANIMATION_BINDING_NONE) {
+							ApplyLayer(layer, nodes + i, channelIndex, locals[i]);
+						}
+					}
+				}
+				continue;
+			}
+
+			for (unsigned int i = 0; i < nodeNum; i++) {
+				unsigned int channelIndex = GetApplicantChannel(layer, nodes + i, i);
+				if (channelIndex != ANIMATION_BINDING_NONE) {
+					ApplyLayer(layer, nodes + i, channelIndex, locals[i]);
+				}
+			}
+		}
+	}
+
+
+	// =======================================================
+	// [Jϊ烏[hs߂iem[hԍ̕\gj
+	// e͕KqOɂ̂ŁA擪Ȃ߂邾ōς
+	// worldTransform̓AtBϊł邱ƁiŌ̍s͎gȂj
+	// =======================================================
+	static void UpdateWorldTransforms(const unsigned int* parentIndexes, unsigned int nodeNum, const M4x4& worldTransform, const NODE_TRANSFORM* locals, M3x4* worlds)
+	{
+		M3x4 rootWorld = M3x4::FromM4x4(worldTransform);
+		for (unsigned int i = 0; i < nodeNum; i++) {
+			const NODE_TRANSFORM& local = locals[i];
+			const M3x4& parentWorld = (parentIndexes[i] == NODE_PARENT_NONE) ? rootWorld : worlds[parentIndexes[i]];
+			worlds[i] = M3x4::FromTRS(local.scale, local.rotate, local.position, parentWorld);
+		}
+	}
+
+	void UpdateNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose)
+	{
+		UpdateWorldTransforms(model->parentIndexes.data(), model->nodeNum, worldTransform, pose.GetLocals(), pose.GetWorlds());
+	}
+
+	void UpdateNodeWorldTransforms(const POSE_UPDATE* updates, size_t updateNum)
+	{
+		for (size_t i = 0; i < updateNum; i++) {
+			const POSE_UPDATE& update = updates[i];
+			UpdateWorldTransforms(update.model->parentIndexes.data(), update.model->nodeNum, update.worldTransform, update.pose->GetLocals(), update.pose->GetWorlds());
+		}
+	}
+
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose)
+	{
+		LoadNodeLocalTransforms(model, pose);
+		UpdateNodeWorldTransforms(model, worldTransform, pose);
+	}
+
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants)
+	{
+		LoadNodeLocalTransforms(model, pose, animationApplicants);
+		UpdateNodeWorldTransforms(model, worldTransform, pose);
+	}
+
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t)
+	{
+		LoadNodeLocalTransforms(model, pose, animationSet0, animationSet1, t);
+		UpdateNodeWorldTransforms(model, worldTransform, pose);
+	}
+
+
+	// =======================================================
+	// std::mapŁiC^[tF[Xj
+	// ꎞIȎpobt@ŌvZďo
+	// =======================================================
+	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms)
+	{
+		Pose pose(GetNodeIndexRange(currentNode, currentNode));
+		LoadLocalTransforms(currentNode, currentNode, pose.GetLocals());
+		UpdateWorldTransforms(currentNode, currentNode, M3x4::FromM4x4(worldTransform), pose.GetLocals(), pose.GetWorlds());
+		pose.CopyTo(currentNode, nodeWorldTransforms);
+	}
+
+	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms,
+		const std::vector<ANIMATION_APPLICANT>& animationApplicants)
+	{
+		Pose pose(GetNodeIndexRange(currentNode, currentNode));
+		LoadLocalTransforms(currentNode, currentNode, pose.GetLocals(), animationApplicants);
+		UpdateWorldTransforms(currentNode, currentNode, M3x4::FromM4x4(worldTransform), pose.GetLocals(), pose.GetWorlds());
+		pose.CopyTo(currentNode, nodeWorldTransforms);
+	}
+
+	void LoadNodeWorldTransforms(MODEL_NODE* currentNode, const M4x4& worldTransform, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t)
+	{
+		Pose pose(GetNodeIndexRange(currentNode, currentNode));
+		LoadLocalTransforms(currentNode, currentNode, pose.GetLocals(), animationSet0, animationSet1, t);
+		UpdateWorldTransforms(currentNode, currentNode, M3x4::FromM4x4(worldTransform), pose.GetLocals(), pose.GetWorlds());
+		pose.CopyTo(currentNode, nodeWorldTransforms);
+	}
+
+} // namespace MG
@@ -0,0 +1,109 @@
+// =======================================================
+// pose.h
+// 
+// f̎p
+// m[hԍirootNodëʒuj̘AzŁA
+// [JϊiTRSjƃ[hsiAtBȂ̂M3x4j
+// 
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _POSE_H
+#define _POSE_H
+
+#include "MGCommon.h"
+#include "MGDataType.h"
+
+namespace MG {
+
+	// m[h̃[Jϊ
+	struct NODE_TRANSFORM {
+		F3 scale;
+		Quaternion rotate;
+		F3 position;
+	};
+
+	// dݕtuh̐K@
+	enum ANIMATION_BLEND_NORMALIZE {
+		ANIMATION_BLEND_NORMALIZE_BIND_POSE,	// d݂̍v1ȂcoCh|[YŖ߂
+		ANIMATION_BLEND_NORMALIZE_NODE,			// m[hƂɃ`lAj[V̏d݂̍vŊ
+		ANIMATION_BLEND_NORMALIZE_NONE			// d݂̂܂܎gi]͐Kj
+	};
+
+	// =======================================================
+	// pobt@
+	// 
+	// xmۂg񂵁At[̊mۂȂ
+	// Resize͑傫ȂƂmۂ
+	// =======================================================
+	class Pose {
+	private:
+		std::vector<NODE_TRANSFORM> locals;
+		std::vector<M3x4> worlds;
+	public:
+		Pose() = default;
+		Pose(unsigned int nodeNum);
+		void Resize(unsigned int nodeNum);
+		unsigned int GetNodeNum() const;
+		NODE_TRANSFORM* GetLocals();
+		const NODE_TRANSFORM* GetLocals() const;
+		M3x4* GetWorlds();
+		const M3x4* GetWorlds() const;
+		const M3x4& GetWorld(unsigned int nodeIndex) const;
+		void CopyFrom(const MODEL_NODE* rootNode, const std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms);
+		void CopyTo(MODEL_NODE* rootNode, std::map<MODEL_NODE*, M4x4>& nodeWorldTransforms) const;
+	};
+
+	// =======================================================
+	// {[}XN
+	// 
+	// m[hԍ̃rbgW
+	// ANIMATION_APPLICANTɕtƁAOꂽm[h̓TvOȂ
+	// =======================================================
+	class BoneMask {
+	private:
+		std::vector<unsigned int> bits;
+		unsigned int nodeNum = 0;
+	public:
+		BoneMask() = default;
+		BoneMask(unsigned int nodeNum);
+		void Resize(unsigned int nodeNum);
+		unsigned int GetNodeNum() const;
+		unsigned int GetWordNum() const;
+		const unsigned int* GetWords() const;
+		bool Test(unsigned int nodeIndex) const;
+		void Set(unsigned int nodeIndex, bool enable = true);
+		void SetAll(bool enable = true);
+		void SetNode(const Model* model, const MODEL_NODE* node, bool withChildren = true, bool enable = true);
+		void SetBinding(const AnimationBinding* binding, bool enable = true);
+	};
+
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose);
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants);
+	// updateMaskŊOꂽm[h̓[JϊȂiO̎p̂܂܁j
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants, const BoneMask& updateMask);
+	void LoadNodeLocalTransforms(const Model* model, Pose& pose,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t);
+	// ̎p̃[JϊtŕԁiSIMDob`A]GetQuaternionBlendModejAoutpose0Apose1Ɠł
+	void BlendPoses(const Pose& pose0, const Pose& pose1, float t, Pose& out);
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose);
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants);
+	void LoadNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose,
+		const std::vector<ANIMATION_APPLICANT>& animationSet0, const std::vector<ANIMATION_APPLICANT>& animationSet1, float t);
+	void UpdateNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose);
+	void ApplyNodeLayers(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationLayers);
+	void BlendNodeLocalTransforms(const Model* model, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants,
+		ANIMATION_BLEND_NORMALIZE normalize = ANIMATION_BLEND_NORMALIZE_BIND_POSE);
+	void BlendNodeWorldTransforms(const Model* model, const M4x4& worldTransform, Pose& pose, const std::vector<ANIMATION_APPLICANT>& animationApplicants,
+		ANIMATION_BLEND_NORMALIZE normalize = ANIMATION_BLEND_NORMALIZE_BIND_POSE);
+
+	// f̃[hs܂Ƃ߂čXV
+	struct POSE_UPDATE {
+		const Model* model;
+		M4x4 worldTransform;
+		Pose* pose;
+	};
+	void UpdateNodeWorldTransforms(const POSE_UPDATE* updates, size_t updateNum);
+
+} // namespace MG
+
+#endif
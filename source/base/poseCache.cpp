@@ -0,0 +1,115 @@
+// =======================================================
+// poseCache.cpp
+//
+// LpLbV
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "poseCache.h"
+#include "resourceTool.h"
+#include <cstring>
+
+namespace MG {
+
+	PoseCache::~PoseCache()
+	{
+		for (ENTRY* entry : entries) {
+			delete entry;
+		}
+	}
+
+	void PoseCache::SetFrameStep(float frameStep)
+	{
+		this->frameStep = frameStep;
+	}
+
+	float PoseCache::GetFrameStep() const
+	{
+		return frameStep;
+	}
+
+
+	// =======================================================
+	// ]
+	// 1. Ώۂ̃WuL[ł܂Ƃ߁AL[ƂɈ̎p蓖Ă
+	// 2. pƂ̃[JϊTvOij
+	// 3. SWu]AΏۂ̃Wu̓[JϊRs[ă[hs񂾂ij
+	// =======================================================
+	void PoseCache::Evaluate(CrowdEvaluator& evaluator, CROWD_JOB* jobs, size_t jobNum)
+	{
+		stats = {};
+		entryIndexes.clear();
+		entryNum = 0;
+		sampleJobs.clear();
+
+		for (size_t i = 0; i < jobNum; i++) {
+			CROWD_JOB& job = jobs[i];
+			job.sharedPose = nullptr;
+			job.localsOnly = false;
+			if (job.coast || job.updateMask || !job.animationApplicants || job.animationApplicants->size() != 1) {
+				continue;
+			}
+			const ANIMATION_APPLICANT& applicant = job.animationApplicants->front();
+			if (!applicant.binding || applicant.mask) {
+				continue;
+			}
+
+			float frame = applicant.currentFrame;
+			KEY key = { applicant.binding, 0 };
+			if (frameStep > 0.0f) {
+				key.frame = (long long)floorf(frame / frameStep + 0.5f);
+				frame = key.frame * frameStep;
+			}
+			else {
+				// ۂ߂ȂƂ̓t[̃rbĝ܂܃L[ɂ
+				unsigned int bits;
+				memcpy(&bits, &frame, sizeof(bits));
+				key.frame = bits;
+			}
+
+			stats.lookupNum++;
+			auto itr = entryIndexes.find(key);
+			if (itr == entryIndexes.end()) {
+				if (entryNum == entries.size()) {
+					entries.push_back(new ENTRY());
+				}
+				ENTRY* entry = entries[entryNum];
+				entry->applicants.clear();
+				entry->applicants.push_back({ applicant.animation, frame, &entry->cursor, applicant.binding });
+				itr = entryIndexes.emplace(key, entryNum).first;
+				entryNum++;
+
+				CROWD_JOB sampleJob = { job.model, &entry->applicants, job.worldTransform, &entry->pose };
+				sampleJob.localsOnly = true;
+				sampleJobs.push_back(sampleJob);
+			}
+			else {
+				stats.hitNum++;
+			}
+			job.sharedPose = &entries[itr->second]->pose;
+		}
+
+		evaluator.Evaluate(sampleJobs);
+		evaluator.Evaluate(jobs, jobNum);
+
+		stats.entryNum = entryNum;
+		stats.hitRate = stats.lookupNum ? (float)stats.hitNum / stats.lookupNum : 0.0f;
+		stats.memoryBytes = entries.capacity() * sizeof(ENTRY*) + sampleJobs.capacity() * sizeof(CROWD_JOB)
+			+ entryIndexes.bucket_count() * sizeof(void*) + entryIndexes.size() * (sizeof(KEY) + sizeof(unsigned int) + sizeof(void*));
+		for (const ENTRY* entry : entries) {
+			stats.memoryBytes += sizeof(ENTRY) + entry->pose.GetNodeNum() * (sizeof(NODE_TRANSFORM) + sizeof(M3x4))
+				+ entry->applicants.capacity() * sizeof(ANIMATION_APPLICANT);
+		}
+	}
+
+	void PoseCache::Evaluate(CrowdEvaluator& evaluator, std::vector<CROWD_JOB>& jobs)
+	{
+		Evaluate(evaluator, jobs.data(), jobs.size());
+	}
+
+	const POSE_CACHE_STATS& PoseCache::GetStats() const
+	{
+		return stats;
+	}
+
+} // namespace MG
@@ -0,0 +1,75 @@
+// =======================================================
+// poseCache.h
+//
+// LpLbV
+// QO̒œAj[Vقړt[ōĐĂCX^X́A
+// iAnimationBindingAʎqt[jƂɈ񂾂TvO[JϊLA
+// ꂼ̃[hšvZs
+// t[frameStepPʂɊۂ߂̂ŁAőframeStep / 2t[i0Ȃۂ߂Ȃj
+//
+// LbV1t[iEvaluatêтɍ蒼AmۂPose͎g񂷁j
+// Ώۂ̓oCfBÖANIMATION_APPLICANTi}XNȂj̃Wu
+// Aj[VLODcoastAupdateMasktWu͂̂܂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _POSE_CACHE_H
+#define _POSE_CACHE_H
+
+#include "crowd.h"
+#include "resourceTool.h"
+#include <unordered_map>
+
+namespace MG {
+
+	// EvaluatȅWv
+	struct POSE_CACHE_STATS {
+		unsigned int lookupNum;		// LbV̑ΏۂɂȂWu
+		unsigned int hitNum;		// TvOɍς񂾃Wu
+		unsigned int entryNum;		// TvOp̐
+		size_t memoryBytes;			// mۂĂLbVŚig񂵕܂ށj
+		float hitRate;				// hitNum / lookupNum
+	};
+
+	class PoseCache {
+	private:
+		struct ENTRY {
+			Pose pose;
+			AnimationCursor cursor;
+			std::vector<ANIMATION_APPLICANT> applicants;	// ʎqt[̃Rs[
+		};
+		struct KEY {
+			const AnimationBinding* binding;
+			long long frame;
+			bool operator==(const KEY& key) const { return binding == key.binding && frame == key.frame; }
+		};
+		struct KEY_HASH {
+			size_t operator()(const KEY& key) const {
+				return std::hash<const void*>()(key.binding) ^ (std::hash<long long>()(key.frame) * 0x9e3779b97f4a7c15ull);
+			}
+		};
+
+		std::vector<ENTRY*> entries;		// g񂷁AAhXςȂ悤|C^Ŏ
+		unsigned int entryNum = 0;
+		std::unordered_map<KEY, unsigned int, KEY_HASH> entryIndexes;
+		std::vector<CROWD_JOB> sampleJobs;
+		float frameStep = 1.0f;
+		POSE_CACHE_STATS stats = {};
+	public:
+		PoseCache() = default;
+		~PoseCache();
+		PoseCache(const PoseCache&) = delete;
+		PoseCache& operator=(const PoseCache&) = delete;
+
+		void SetFrameStep(float frameStep);
+		float GetFrameStep() const;
+
+		// LWu蓖ĂăTvOǍWuŜ]
+		void Evaluate(CrowdEvaluator& evaluator, CROWD_JOB* jobs, size_t jobNum);
+		void Evaluate(CrowdEvaluator& evaluator, std::vector<CROWD_JOB>& jobs);
+		const POSE_CACHE_STATS& GetStats() const;
+	};
+
+} // namespace MG
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "MGCommon.h"
 #include "camera.h"
+#include "skinning.h"
 
 namespace MG {
 
@@ -64,8 +65,9 @@ namespace MG {
 		virtual void SetColor(const F4& color) = 0;
 		virtual void SetUVOffset(const F2& uvOffset) = 0;
 		virtual void SetUVRange(const F2& uvRange) = 0;
-		virtual void SetBones(MESH_BONE* bones, size_t size) = 0;
-		virtual void SetUseBone(bool enable) = 0;
+		virtual void SetBones(const M3x4* palette, size_t size) = 0;
+		virtual void SetDualQuaternionBones(const DUAL_QUATERNION* palette, size_t size, const M3x4& space) = 0;
+		virtual void SetUseBone(bool enable, SKINNING_MODE mode = SKINNING_MODE_LINEAR) = 0;
 		virtual RenderTarget* CreateRenderTarget(unsigned int width = GetScreenWidth(), unsigned int height = GetScreenHeight()) = 0;
 		virtual void ReleaseRenderTarget(RenderTarget* renderTarget) = 0;
 		virtual void SetRenderTarget(RenderTarget* renderTarget) = 0;
@@ -284,6 +284,21 @@ namespace MG {
 			pVSBlob->Release();
 		}
 
+		// fANH[^jIXLjOi͂BoneVertexShaderPolygonƓȂ̂ŃCAEg͋Lj
+		{
+			ID3DBlob* pErrorBlob;
+			ID3DBlob* pVSBlob = NULL;
+			HRESULT hr = D3DCompileFromFile(L"shader.hlsl", NULL, NULL, "DualQuaternionBoneVertexShaderPolygon", "vs_4_0", D3DCOMPILE_ENABLE_STRICTNESS, 0, &pVSBlob, &pErrorBlob);
+			if (FAILED(hr))
+			{
+				MessageBox(NULL, (char*)pErrorBlob->GetBufferPointer(), "VS", MB_OK | MB_ICONERROR);
+			}
+
+			m_device->CreateVertexShader(pVSBlob->GetBufferPointer(), pVSBlob->GetBufferSize(), NULL, &m_DualQuaternionBoneVertexShader);
+
+			pVSBlob->Release();
+		}
+
 		// sNZVF[_RpCE
 		{
 			ID3DBlob* pErrorBlob;
@@ -375,6 +390,18 @@ namespace MG {
 			GetDevice()->CreateBuffer(&hBufferDesc, NULL, &m_BoneBuffer);
 			GetDeviceContext()->VSSetConstantBuffers(3, 1, &m_BoneBuffer);
 		}
+		{
+			D3D11_BUFFER_DESC hBufferDesc = {};
+			hBufferDesc.ByteWidth = sizeof(DUAL_QUATERNION_BONE_BUFFER);
+			hBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+			hBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+			hBufferDesc.CPUAccessFlags = 0;
+			hBufferDesc.MiscFlags = 0;
+			hBufferDesc.StructureByteStride = sizeof(float);
+
+			GetDevice()->CreateBuffer(&hBufferDesc, NULL, &m_DualQuaternionBoneBuffer);
+			GetDeviceContext()->VSSetConstantBuffers(4, 1, &m_DualQuaternionBoneBuffer);
+		}
 
 		// ̓CAEgݒ
 		m_context->IASetInputLayout(m_VertexLayout);
@@ -410,11 +437,13 @@ namespace MG {
 		m_MaterialBuffer->Release();
 		m_LightBuffer->Release();
 		m_BoneBuffer->Release();
+		m_DualQuaternionBoneBuffer->Release();
 
 		m_VertexLayout->Release();
 		m_VertexShader->Release();
 		m_BoneVertexLayout->Release();
 		m_BoneVertexShader->Release();
+		m_DualQuaternionBoneVertexShader->Release();
 		m_PixelShader->Release();
 		m_PixelShaderPolygon->Release();
 		m_PixelShaderNoLighting->Release();
@@ -532,7 +561,7 @@ namespace MG {
 		this->uvRange = { uvRange.x, uvRange.y };
 	}
 
-	void RendererDX::SetBones(MESH_BONE* bones, size_t size)
+	void RendererDX::SetBones(const M3x4* palette, size_t size)
 	{
 		BONE_BUFFER boneBuff = {
 		};
@@ -547,31 +576,36 @@ namespace MG {
 			));
 		}*/
 		//XMMatrixTranspose
-		for (unsigned int i = 0; i < size; i++) {
-			M4x4& offset = bones[i].offset;
-			M4x4& world = bones[i].world;
-			XMStoreFloat4x4(&boneBuff.boneOffsetMatrix[i], (XMMATRIX(
-				offset._v00, offset._v10, offset._v20, offset._v30,
-				offset._v01, offset._v11, offset._v21, offset._v31,
-				offset._v02, offset._v12, offset._v22, offset._v32,
-				offset._v03, offset._v13, offset._v23, offset._v33
-			)));
-			XMStoreFloat4x4(&boneBuff.boneWorldMatrix[i], (XMMATRIX(
-				world._v00, world._v10, world._v20, world._v30,
-				world._v01, world._v11, world._v21, world._v31,
-				world._v02, world._v12, world._v22, world._v32,
-				world._v03, world._v13, world._v23, world._v33
-			)));
+		if (size > SKIN_PALETTE_MAX) {
+			size = SKIN_PALETTE_MAX;
 		}
+		memcpy(boneBuff.bonePalette, palette, sizeof(M3x4) * size);
 		
 		m_context->UpdateSubresource(m_BoneBuffer, 0, NULL, &boneBuff, 0, 0);
 	}
 
-	void RendererDX::SetUseBone(bool enable)
+	void RendererDX::SetDualQuaternionBones(const DUAL_QUATERNION* palette, size_t size, const M3x4& space)
+	{
+		DUAL_QUATERNION_BONE_BUFFER boneBuff = {};
+		boneBuff.space = space;
+		if (size > SKIN_PALETTE_MAX) {
+			size = SKIN_PALETTE_MAX;
+		}
+		memcpy(boneBuff.bonePalette, palette, sizeof(DUAL_QUATERNION) * size);
+
+		m_context->UpdateSubresource(m_DualQuaternionBoneBuffer, 0, NULL, &boneBuff, 0, 0);
+	}
+
+	void RendererDX::SetUseBone(bool enable, SKINNING_MODE mode)
 	{
 		if (enable) {
 			m_context->IASetInputLayout(m_BoneVertexLayout);
-			m_context->VSSetShader(m_BoneVertexShader, NULL, 0);
+			if (mode == SKINNING_MODE_DUAL_QUATERNION) {
+				m_context->VSSetShader(m_DualQuaternionBoneVertexShader, NULL, 0);
+			}
+			else {
+				m_context->VSSetShader(m_BoneVertexShader, NULL, 0);
+			}
 		}
 		else {
 			m_context->IASetInputLayout(m_VertexLayout);
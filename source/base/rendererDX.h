@@ -10,6 +10,7 @@
 #define _RENDERER_DX_H
 
 #include "renderer.h"
+#include "skinning.h"
 
 #pragma warning(push)
 #pragma warning(disable:4005)
@@ -72,12 +73,19 @@ namespace MG {
 		
 	};
 
+	// VF[_[row_major float3x4Ȃ̂ŁAM3x4̍ŝ܂ܕׂ
+	// ItZbgs~[hsiBuildSkinPalettěʁj
 	struct BONE_BUFFER {
-		XMFLOAT4X4 boneOffsetMatrix[100];
-		XMFLOAT4X4 boneWorldMatrix[100];
+		M3x4 bonePalette[SKIN_PALETTE_MAX];
 		
 	};
 
+	// fANH[^jIŁiBuildDualQuaternionPalettěʁj
+	struct DUAL_QUATERNION_BONE_BUFFER {
+		M3x4 space;
+		DUAL_QUATERNION bonePalette[SKIN_PALETTE_MAX];
+	};
+
 	/*struct DX_BONE_VERTEX {
 		XMFLOAT4 position;
 		XMFLOAT4 normal;
@@ -126,6 +134,7 @@ namespace MG {
 		ID3D11VertexShader* m_VertexShader = NULL;
 		ID3D11InputLayout* m_BoneVertexLayout = NULL;
 		ID3D11VertexShader* m_BoneVertexShader = NULL;
+		ID3D11VertexShader* m_DualQuaternionBoneVertexShader = NULL;
 		ID3D11PixelShader* m_PixelShader = NULL;
 		ID3D11PixelShader* m_PixelShaderPolygon = NULL;
 		ID3D11PixelShader* m_PixelShaderNoLighting = NULL;
@@ -136,6 +145,7 @@ namespace MG {
 		ID3D11Buffer* m_ColorBuffer = NULL;
 		ID3D11Buffer* m_LightBuffer = NULL;
 		ID3D11Buffer* m_BoneBuffer = NULL;
+		ID3D11Buffer* m_DualQuaternionBoneBuffer = NULL;
 
 		XMMATRIX m_WorldMatrix = {};
 		XMMATRIX m_ViewMatrix = {};
@@ -187,8 +197,9 @@ namespace MG {
 		void SetColor(const F4& color) override;
 		void SetUVOffset(const F2& uvOffset) override;
 		void SetUVRange(const F2& uvRange) override;
-		void SetBones(MESH_BONE* bones, size_t size) override;
-		void SetUseBone(bool enable) override;
+		void SetBones(const M3x4* palette, size_t size) override;
+		void SetDualQuaternionBones(const DUAL_QUATERNION* palette, size_t size, const M3x4& space) override;
+		void SetUseBone(bool enable, SKINNING_MODE mode = SKINNING_MODE_LINEAR) override;
 		RenderTarget* CreateRenderTarget(unsigned int width = GetScreenWidth(), unsigned int height = GetScreenHeight()) override;
 		void ReleaseRenderTarget(RenderTarget* renderTarget) override;
 		void SetRenderTarget(RenderTarget* renderTarget) override;
@@ -7,6 +7,9 @@
 // =======================================================
 #include "resourceTool.h"
 #include <typeinfo>
+#include <algorithm>
+#include <assert.h>
+#include <cstring>
 
 namespace MG {
 	Resource::Resource(const HASH key) : key(key)
@@ -25,6 +28,34 @@ namespace MG {
 	HASH Model::GetType() { return Model::TYPE; }
 	HASH Animation::GetType() { return Animation::TYPE; }
 
+	// =======================================================
+	// m[hԍƐem[hԍ̕\
+	// MGObject̃m[h͎q̕тKeɂ̂ŁA
+	// m[hԍɏΐeɊm肷ig|WJj
+	// =======================================================
+	static void LoadParentIndexes(const MODEL_NODE* rootNode, const MODEL_NODE* currentNode, std::vector<unsigned int>& parentIndexes)
+	{
+		unsigned int nodeIndex = (unsigned int)(currentNode - rootNode);
+		for (unsigned int i = 0; i < currentNode->childrenNum; i++) {
+			const MODEL_NODE* child = currentNode->children + i;
+			assert((unsigned int)(child - rootNode) > nodeIndex);
+			parentIndexes[child - rootNode] = nodeIndex;
+			LoadParentIndexes(rootNode, child, parentIndexes);
+		}
+	}
+
+	void Model::LoadNodeHierarchy()
+	{
+		nodeNum = GetModelNodeNum(rawModel->rootNode);
+		parentIndexes.assign(nodeNum, NODE_PARENT_NONE);
+		LoadParentIndexes(rawModel->rootNode, rawModel->rootNode, parentIndexes);
+	}
+
+	unsigned int Model::GetNodeIndex(const MODEL_NODE* node) const
+	{
+		return (unsigned int)(node - rawModel->rootNode);
+	}
+
 	Texture::Texture(const HASH key, unsigned int width, unsigned int height)
 		: Resource(key), width(width), height(height) {}
 
@@ -40,87 +71,811 @@ namespace MG {
 	Model::Model(const HASH key) : Resource(key) {}
 	Animation::Animation(const HASH key) : Resource(key) {}
 
-	void Animation::Apply(const std::string& nodeName, float frame, F3& size, F3& position, Quaternion& rotate)
+	void Animation::Apply(const std::string& nodeName, float frame, F3& size, F3& position, Quaternion& rotate, AnimationCursor* cursor) const
 	{
-		ANIMATION_CHANNEL* animationChannel = nullptr;
 		auto itr = modelNodeChannels.find(nodeName);
-		if (itr != modelNodeChannels.end()) {
-			animationChannel = itr->second;
+		if (itr == modelNodeChannels.end()) {
+			return;
 		}
-		else {
+
+		ApplyChannel(itr->second - rawAnimation->channels, frame, &size, &position, &rotate, cursor);
+	}
+
+
+	// =======================================================
+	// `lԍwŃAj[VKp
+	// ۑ`̗D揇Fkς݂ȂʎqL[fR[hĕԁA
+	// TvOς݂ȂgbN𒼐ڎQƁA
+	// OԂ̐ڐ΃L[t[TĎOԁA
+	// ǂłȂ΃L[t[TĐ`
+	// =======================================================
+	void Animation::ApplyChannel(unsigned int channelIndex, float frame, F3* size, F3* position, Quaternion* rotate, AnimationCursor* cursor) const
+	{
+		if (!compressedChannels.empty()) {
+			CHANNEL_CURSOR* channelCursor = cursor ? cursor->GetChannelCursor(this, channelIndex) : nullptr;
+			ApplyAnimation(&compressedAnimation, channelIndex, frame, size, position, rotate, channelCursor);
+			return;
+		}
+		if (!resampledChannels.empty()) {
+			ApplyAnimation(&resampledChannels[channelIndex], frame, size, position, rotate);
 			return;
 		}
+		CHANNEL_CURSOR* channelCursor = cursor ? cursor->GetChannelCursor(this, channelIndex) : nullptr;
+		if (!cubicChannels.empty()) {
+			ApplyAnimation(rawAnimation->channels + channelIndex, &cubicChannels[channelIndex], frame, size, position, rotate, channelCursor);
+			return;
+		}
+		ApplyAnimation(rawAnimation->channels + channelIndex, frame, size, position, rotate, channelCursor);
+	}
 
-		if (animationChannel->positionKeyNum) {
-			VECTOR_KEY* minKey = animationChannel->positionKeys;
-			VECTOR_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->positionKeyNum; i++) {
-				if (frame < animationChannel->positionKeys[i].frame) {
-					maxKey = (animationChannel->positionKeys + i);
-					break;
-				}
-				else {
-					minKey = (animationChannel->positionKeys + i);
-					maxKey = minKey;
-				}
+
+	// =======================================================
+	// S`lt[[gi1t[1Tvj
+	// TvOSoAgbNɕϊ
+	// ̃L[t[͎ĉŁAgȂReleaseKeysŉ
+	// =======================================================
+	static unsigned int GetResampleNum(unsigned int keyNum, float lastFrame)
+	{
+		if (keyNum < 2) {
+			return keyNum;
+		}
+		return (unsigned int)ceilf((lastFrame > 0.0f) ? lastFrame : 0.0f) + 1;
+	}
+
+	void Animation::Resample()
+	{
+		if (!resampledChannels.empty() || !compressedChannels.empty()) {
+			return;
+		}
+
+		// KvȃTv𐔂Ĉꊇm
+		size_t floatNum = 0;
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			if (channel.positionKeyNum) floatNum += 3 * GetResampleNum(channel.positionKeyNum, channel.positionKeys[channel.positionKeyNum - 1].frame);
+			if (channel.scalingKeyNum) floatNum += 3 * GetResampleNum(channel.scalingKeyNum, channel.scalingKeys[channel.scalingKeyNum - 1].frame);
+			if (channel.rotationKeyNum) floatNum += 4 * GetResampleNum(channel.rotationKeyNum, channel.rotationKeys[channel.rotationKeyNum - 1].frame);
+		}
+		resampledData.resize(floatNum);
+		resampledChannels.resize(rawAnimation->channelNum);
+
+		float* current = resampledData.data();
+		auto allocTrack = [&current](ANIMATION_TRACK& track, unsigned int sampleNum, bool hasW) {
+			track.sampleNum = sampleNum;
+			track.x = current; current += sampleNum;
+			track.y = current; current += sampleNum;
+			track.z = current; current += sampleNum;
+			if (hasW) {
+				track.w = current; current += sampleNum;
 			}
-			float d = (maxKey->frame - minKey->frame);
-			if (d > 0.0f) {
-				float t = (frame - minKey->frame) / d;
-				position = minKey->vector * (1.0f - t) + maxKey->vector * t;
+		};
+
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			RESAMPLED_CHANNEL& resampled = resampledChannels[i];
+			if (channel.positionKeyNum) allocTrack(resampled.position, GetResampleNum(channel.positionKeyNum, channel.positionKeys[channel.positionKeyNum - 1].frame), false);
+			if (channel.scalingKeyNum) allocTrack(resampled.scaling, GetResampleNum(channel.scalingKeyNum, channel.scalingKeys[channel.scalingKeyNum - 1].frame), false);
+			if (channel.rotationKeyNum) allocTrack(resampled.rotation, GetResampleNum(channel.rotationKeyNum, channel.rotationKeys[channel.rotationKeyNum - 1].frame), true);
+
+			// ̕ԏŃTvOiĐȂ̂ŃJ[\ŒTȂj
+			CHANNEL_CURSOR cursor = {};
+			for (unsigned int s = 0; s < resampled.position.sampleNum; s++) {
+				F3 position = {};
+				ApplyAnimation(&channel, (float)s, nullptr, &position, nullptr, &cursor);
+				resampled.position.x[s] = position.x;
+				resampled.position.y[s] = position.y;
+				resampled.position.z[s] = position.z;
 			}
-			else {
-				position = minKey->vector;
+			for (unsigned int s = 0; s < resampled.scaling.sampleNum; s++) {
+				F3 size = {};
+				ApplyAnimation(&channel, (float)s, &size, nullptr, nullptr, &cursor);
+				resampled.scaling.x[s] = size.x;
+				resampled.scaling.y[s] = size.y;
+				resampled.scaling.z[s] = size.z;
+			}
+			for (unsigned int s = 0; s < resampled.rotation.sampleNum; s++) {
+				Quaternion rotate = {};
+				ApplyAnimation(&channel, (float)s, nullptr, nullptr, &rotate, &cursor);
+				resampled.rotation.x[s] = rotate.x;
+				resampled.rotation.y[s] = rotate.y;
+				resampled.rotation.z[s] = rotate.z;
+				resampled.rotation.w[s] = rotate.w;
 			}
 		}
+	}
 
-		if (animationChannel->scalingKeyNum) {
-			VECTOR_KEY* minKey = animationChannel->scalingKeys;
-			VECTOR_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->scalingKeyNum; i++) {
-				if (frame < animationChannel->scalingKeys[i].frame) {
-					maxKey = (animationChannel->scalingKeys + i);
-					break;
+	bool Animation::IsResampled() const
+	{
+		return !resampledChannels.empty();
+	}
+
+
+	// =======================================================
+	// OԂ̐ڐOvZiCatmull-Romj
+	// ̃L[͑ÕL[̍t[ŊiL[Ԋusł悢jA
+	// [͎RXvC̒[̏i[œK0jŗׂ̐ڐ猈߂
+	// ]͑ÕL[iƐڐjƓɑĂg
+	// L[t[̂܂܍Đꍇg
+	// =======================================================
+	template<typename KEY, typename VALUE, typename GET_VALUE, typename GET_SIGN>
+	static void ComputeTangents(const KEY* keys, unsigned int keyNum, VALUE* tangents, const VALUE& zero, GET_VALUE getValue, GET_SIGN getSign)
+	{
+		// baseƓɑl
+		auto aligned = [&](unsigned int index, unsigned int base) {
+			return getValue(keys[index]) * getSign(keys[index], keys[base]);
+		};
+		for (unsigned int i = 0; i < keyNum; i++) {
+			unsigned int prev = (i > 0) ? i - 1 : i;
+			unsigned int next = (i + 1 < keyNum) ? i + 1 : i;
+			float d = keys[next].frame - keys[prev].frame;
+			tangents[i] = (d > 0.0f) ? (aligned(next, i) - aligned(prev, i)) * (1.0f / d) : zero;
+		}
+		if (keyNum < 3) {
+			return;
+		}
+
+		// [Fm = (3 * Ԃ̌X - ׂ̐ڐ) / 2
+		auto endTangent = [&](unsigned int end, unsigned int near) {
+			float d = keys[near].frame - keys[end].frame;
+			if (d == 0.0f) {
+				return tangents[end];
+			}
+			VALUE slope = (aligned(near, end) - getValue(keys[end])) * (1.0f / d);
+			return slope * 1.5f - tangents[near] * (0.5f * getSign(keys[near], keys[end]));
+		};
+		tangents[0] = endTangent(0, 1);
+		tangents[keyNum - 1] = endTangent(keyNum - 1, keyNum - 2);
+	}
+
+	static Quaternion operator-(const Quaternion& q0, const Quaternion& q1)
+	{
+		return { q0.x - q1.x, q0.y - q1.y, q0.z - q1.z, q0.w - q1.w };
+	}
+
+	static Quaternion operator*(const Quaternion& q, float s)
+	{
+		return { q.x * s, q.y * s, q.z * s, q.w * s };
+	}
+
+	void Animation::ComputeCubicTangents()
+	{
+		if (!cubicChannels.empty() || !resampledChannels.empty() || !compressedChannels.empty()) {
+			return;
+		}
+
+		size_t vectorNum = 0;
+		size_t rotationNum = 0;
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			vectorNum += channel.positionKeyNum + channel.scalingKeyNum;
+			rotationNum += channel.rotationKeyNum;
+		}
+		cubicVectorTangents.resize(vectorNum);
+		cubicRotationTangents.resize(rotationNum);
+		cubicChannels.resize(rawAnimation->channelNum);
+
+		auto getVector = [](const VECTOR_KEY& key) { return key.vector; };
+		auto getVectorSign = [](const VECTOR_KEY&, const VECTOR_KEY&) { return 1.0f; };
+		auto getRotation = [](const QUATERNION_KEY& key) { return key.rotate; };
+		auto getRotationSign = [](const QUATERNION_KEY& key, const QUATERNION_KEY& base) { return (Dot(key.rotate, base.rotate) < 0.0f) ? -1.0f : 1.0f; };
+
+		F3* vectorTangents = cubicVectorTangents.data();
+		Quaternion* rotationTangents = cubicRotationTangents.data();
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			CUBIC_CHANNEL& cubic = cubicChannels[i];
+			if (channel.positionKeyNum) {
+				ComputeTangents(channel.positionKeys, channel.positionKeyNum, vectorTangents, F3{}, getVector, getVectorSign);
+				cubic.positionTangents = vectorTangents;
+				vectorTangents += channel.positionKeyNum;
+			}
+			if (channel.scalingKeyNum) {
+				ComputeTangents(channel.scalingKeys, channel.scalingKeyNum, vectorTangents, F3{}, getVector, getVectorSign);
+				cubic.scalingTangents = vectorTangents;
+				vectorTangents += channel.scalingKeyNum;
+			}
+			if (channel.rotationKeyNum) {
+				ComputeTangents(channel.rotationKeys, channel.rotationKeyNum, rotationTangents, Quaternion{ 0.0f, 0.0f, 0.0f, 0.0f }, getRotation, getRotationSign);
+				cubic.rotationTangents = rotationTangents;
+				rotationTangents += channel.rotationKeyNum;
+			}
+		}
+	}
+
+	bool Animation::IsCubic() const
+	{
+		return !cubicChannels.empty();
+	}
+
+
+	// =======================================================
+	// ̉]̊pxiWAj
+	// Ƃacosł͐xoȂ̂Ō̒狁߂
+	// =======================================================
+	static float RotationDifference(const Quaternion& q0, const Quaternion& q1)
+	{
+		float sign = (Dot(q0, q1) < 0.0f) ? -1.0f : 1.0f;
+		float dx = q0.x - q1.x * sign;
+		float dy = q0.y - q1.y * sign;
+		float dz = q0.z - q1.z * sign;
+		float dw = q0.w - q1.w * sign;
+		float chord = sqrtf(dx * dx + dy * dy + dz * dz + dw * dw) * 0.5f;
+		return 4.0f * asinf((chord < 1.0f) ? chord : 1.0f);
+	}
+
+	// =======================================================
+	// e덷Ɏ܂L[ci×~@j
+	// ԂL΂邾L΂AԂ̌L[ł
+	// e덷𒴂炻̎ÕL[c
+	// Ԃ͋敪`Ȃ̂ŁA덷͌L[̈ʒuׂ΂悢
+	// =======================================================
+	template<typename VALUE, typename INTERPOLATE, typename MEASURE>
+	static void ReduceKeys(const std::vector<float>& frames, const std::vector<VALUE>& values, const std::vector<VALUE>& decoded,
+		float budget, INTERPOLATE interpolate, MEASURE measure, std::vector<unsigned int>& keptIndexes)
+	{
+		unsigned int keyNum = (unsigned int)frames.size();
+		keptIndexes.clear();
+		keptIndexes.push_back(0);
+
+		// SL[擪L[ŕ\Ȃ萔gbN
+		bool constant = true;
+		for (unsigned int k = 1; k < keyNum && constant; k++) {
+			constant = measure(decoded[0], values[k]) <= budget;
+		}
+		if (constant) {
+			return;
+		}
+
+		unsigned int start = 0;
+		while (start + 1 < keyNum) {
+			unsigned int end = start + 1;
+			while (end + 1 < keyNum) {
+				unsigned int next = end + 1;
+				float d = frames[next] - frames[start];
+				bool valid = true;
+				for (unsigned int k = start + 1; k < next && valid; k++) {
+					float t = (d > 0.0f) ? (frames[k] - frames[start]) / d : 0.0f;
+					valid = measure(interpolate(decoded[start], decoded[next], t), values[k]) <= budget;
 				}
-				else {
-					minKey = (animationChannel->scalingKeys + i);
-					maxKey = minKey;
+				if (!valid) {
+					break;
 				}
+				end = next;
 			}
-			float d = (maxKey->frame - minKey->frame);
-			if (d > 0.0f) {
-				float t = (frame - minKey->frame) / d;
-				size = minKey->vector * (1.0f - t) + maxKey->vector * t;
-			}
-			else {
-				size = minKey->vector;
+			keptIndexes.push_back(end);
+			start = end;
+		}
+	}
+
+	// =======================================================
+	// Lv[ɓo^Aтɂ΂g
+	// ߂l̓v[̈ʒu
+	// =======================================================
+	template<typename VALUE>
+	static unsigned int AddShared(std::vector<VALUE>& pool, std::vector<std::pair<size_t, size_t>>& ranges, const VALUE* values, size_t num)
+	{
+		for (const auto& range : ranges) {
+			if (range.second == num && std::equal(values, values + num, pool.begin() + range.first)) {
+				return (unsigned int)range.first;
 			}
 		}
+		size_t offset = pool.size();
+		pool.insert(pool.end(), values, values + num);
+		ranges.push_back({ offset, num });
+		return (unsigned int)offset;
+	}
+
+	// =======================================================
+	// e덷tňk
+	// 
+	// ʒuEXP[FgbN͈̔͂16bitɗʎqAcL[̗ʎq덷
+	//   e덷𒴂Ȃfloat̂܂
+	// ]Fsmallest-threeA32bitŋe덷Ɏ܂Ȃ48bit
+	// ʎq̒lŕԂĂnodeBudgetsi`l̃m[hjA
+	// ȂbudgetɎ܂L[c
+	// t[\Á͈Aʎqf[^͓eL
+	// ̃L[t[͎ĉŁAgȂReleaseKeysŉ
+	// =======================================================
+	void Animation::Compress(const ANIMATION_ERROR_BUDGET& budget, const std::unordered_map<std::string, ANIMATION_ERROR_BUDGET>* nodeBudgets)
+	{
+		if (!compressedChannels.empty() || !resampledChannels.empty()) {
+			return;
+		}
+
+		auto lerpVector = [](const F3& v0, const F3& v1, float t) { return v0 * (1.0f - t) + v1 * t; };
+		auto measureVector = [](const F3& v0, const F3& v1) { return Distance(v0, v1); };
+		auto lerpRotation = [](const Quaternion& q0, const Quaternion& q1, float t) { return Nlerp(q0, q1, t); };
+		auto measureRotation = [](const Quaternion& q0, const Quaternion& q1) { return RotationDifference(q0, q1); };
+
+		std::vector<std::pair<size_t, size_t>> floatRanges;
+		std::vector<std::pair<size_t, size_t>> dataRanges;
+		std::vector<float> frames;
+		std::vector<unsigned int> keptIndexes;
+		std::vector<float> keptFrames;
+		std::vector<unsigned short> keptData;
+
+		compressedFloats.clear();
+		compressedData.clear();
+		compressedChannels.resize(rawAnimation->channelNum);
+
+		auto addTrack = [&](COMPRESSED_TRACK& track, const std::vector<unsigned short>& packed, unsigned int stride) {
+			track.keyNum = (unsigned int)keptIndexes.size();
+			keptFrames.clear();
+			keptData.clear();
+			for (unsigned int index : keptIndexes) {
+				keptFrames.push_back(frames[index]);
+				keptData.insert(keptData.end(), &packed[index * stride], &packed[index * stride] + stride);
+			}
+			track.frameOffset = AddShared(compressedFloats, floatRanges, keptFrames.data(), keptFrames.size());
+			track.dataOffset = AddShared(compressedData, dataRanges, keptData.data(), keptData.size());
+		};
+
+		auto compressVector = [&](const VECTOR_KEY* keys, unsigned int keyNum, float trackBudget, COMPRESSED_TRACK& track) {
+			if (!keyNum) {
+				return;
+			}
+			std::vector<F3> values(keyNum);
+			frames.resize(keyNum);
+			F3 rangeMin = keys[0].vector;
+			F3 rangeMax = keys[0].vector;
+			for (unsigned int i = 0; i < keyNum; i++) {
+				frames[i] = keys[i].frame;
+				values[i] = keys[i].vector;
+				rangeMin = Min(rangeMin, values[i]);
+				rangeMax = Max(rangeMax, values[i]);
+			}
+			F3 rangeExtent = rangeMax - rangeMin;
+
+			std::vector<unsigned short> packed(keyNum * 3);
+			std::vector<F3> decoded(keyNum);
+			for (unsigned int i = 0; i < keyNum; i++) {
+				packed[i * 3 + 0] = PackRange(values[i].x, rangeMin.x, rangeExtent.x);
+				packed[i * 3 + 1] = PackRange(values[i].y, rangeMin.y, rangeExtent.y);
+				packed[i * 3 + 2] = PackRange(values[i].z, rangeMin.z, rangeExtent.z);
+				decoded[i] = UnpackRange(&packed[i * 3], rangeMin, rangeExtent);
+			}
+			ReduceKeys(frames, values, decoded, trackBudget, lerpVector, measureVector, keptIndexes);
+
+			// cL[̗ʎq덷e͈͓Ȃ16bit
+			float maxError = 0.0f;
+			for (unsigned int index : keptIndexes) {
+				maxError = std::max(maxError, measureVector(decoded[index], values[index]));
+			}
+			if (maxError <= trackBudget) {
+				const float range[] = { rangeMin.x, rangeMin.y, rangeMin.z, rangeExtent.x, rangeExtent.y, rangeExtent.z };
+				track.rangeOffset = AddShared(compressedFloats, floatRanges, range, 6);
+				track.vectorBits = 48;
+				addTrack(track, packed, 3);
+				return;
+			}
+
+			// ͈͂L̂float̂܂܁AL[̍팸s
+			ReduceKeys(frames, values, values, trackBudget, lerpVector, measureVector, keptIndexes);
+			track.keyNum = (unsigned int)keptIndexes.size();
+			keptFrames.clear();
+			std::vector<float> keptValues;
+			for (unsigned int index : keptIndexes) {
+				keptFrames.push_back(frames[index]);
+				keptValues.insert(keptValues.end(), { values[index].x, values[index].y, values[index].z });
+			}
+			track.frameOffset = AddShared(compressedFloats, floatRanges, keptFrames.data(), keptFrames.size());
+			track.dataOffset = AddShared(compressedFloats, floatRanges, keptValues.data(), keptValues.size());
+			track.vectorBits = 96;
+		};
 
-		if (animationChannel->rotationKeyNum) {
-			QUATERNION_KEY* minKey = animationChannel->rotationKeys;
-			QUATERNION_KEY* maxKey = minKey;
-			for (int i = 0; i < animationChannel->rotationKeyNum; i++) {
-				if (frame < animationChannel->rotationKeys[i].frame) {
-					maxKey = (animationChannel->rotationKeys + i);
+		auto compressRotation = [&](const QUATERNION_KEY* keys, unsigned int keyNum, float trackBudget, COMPRESSED_TRACK& track) {
+			if (!keyNum) {
+				return;
+			}
+			std::vector<Quaternion> values(keyNum);
+			frames.resize(keyNum);
+			for (unsigned int i = 0; i < keyNum; i++) {
+				frames[i] = keys[i].frame;
+				values[i] = keys[i].rotate;
+			}
+
+			// 32bit̗ʎq덷e͈͓Ȃ32bit
+			std::vector<unsigned short> packed;
+			std::vector<Quaternion> decoded(keyNum);
+			for (unsigned int bits : { 32u, 48u }) {
+				unsigned int stride = bits / 16;
+				packed.resize(keyNum * stride);
+				float maxError = 0.0f;
+				for (unsigned int i = 0; i < keyNum; i++) {
+					PackQuaternion(values[i], bits, &packed[i * stride]);
+					decoded[i] = UnpackQuaternion(&packed[i * stride], bits);
+					maxError = std::max(maxError, measureRotation(decoded[i], values[i]));
+				}
+				track.rotationBits = bits;
+				if (maxError <= trackBudget) {
 					break;
 				}
-				else {
-					minKey = (animationChannel->rotationKeys + i);
-					maxKey = minKey;
+			}
+			ReduceKeys(frames, values, decoded, trackBudget, lerpRotation, measureRotation, keptIndexes);
+			addTrack(track, packed, track.rotationBits / 16);
+		};
+
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			COMPRESSED_CHANNEL& compressed = compressedChannels[i];
+			ANIMATION_ERROR_BUDGET channelBudget = budget;
+			if (nodeBudgets) {
+				auto itr = nodeBudgets->find(channel.nodeName);
+				if (itr != nodeBudgets->end()) {
+					channelBudget = itr->second;
 				}
 			}
-			float d = (maxKey->frame - minKey->frame);
-			if (d > 0.0f) {
-				float t = (frame - minKey->frame) / d;
-				rotate = Lerp(minKey->rotate, maxKey->rotate, t);
+			compressVector(channel.positionKeys, channel.positionKeyNum, channelBudget.position, compressed.position);
+			compressVector(channel.scalingKeys, channel.scalingKeyNum, channelBudget.scaling, compressed.scaling);
+			compressRotation(channel.rotationKeys, channel.rotationKeyNum, channelBudget.rotation, compressed.rotation);
+		}
+
+		compressedFloats.shrink_to_fit();
+		compressedData.shrink_to_fit();
+		compressedAnimation.channelNum = rawAnimation->channelNum;
+		compressedAnimation.channels = compressedChannels.data();
+		compressedAnimation.floats = compressedFloats.data();
+		compressedAnimation.data = compressedData.data();
+	}
+
+	bool Animation::IsCompressed() const
+	{
+		return !compressedChannels.empty();
+	}
+
+
+	// =======================================================
+	// ̃L[t[̉
+	// TvOǩ͍ĐɃL[t[gȂ̂ŁA
+	// rawAnimationwb_[ƃ`liL[0j̃obt@ɍ蒼
+	// OGetStorageReport̃L[t[Ƃ̔rς܂Ă
+	// L[t[gi[g[V̒oAOԁj͂̌łȂ
+	// =======================================================
+	bool Animation::ReleaseKeys()
+	{
+		if (keysReleased) {
+			return true;
+		}
+		if (compressedChannels.empty() && resampledChannels.empty()) {
+			return false;
+		}
+		releasedKeyReport = GetStorageReport();
+
+		// GetAnimationByMGObjectƓ
+		const unsigned int channelNum = rawAnimation->channelNum;
+		const char* name = rawAnimation->name ? rawAnimation->name : "";
+		size_t size = sizeof(ANIMATION) + strlen(name) + 1 + sizeof(ANIMATION_CHANNEL) * channelNum;
+		for (unsigned int i = 0; i < channelNum; i++) {
+			size += strlen(rawAnimation->channels[i].nodeName) + 1;
+		}
+
+		MGObject mgo = {};
+		mgo.type = MGOBJECT_TYPE_ANIMATION;
+		mgo.size = size;
+		mgo.data = new char[size];
+		char* current = mgo.data;
+		ANIMATION header = *rawAnimation;
+		memcpy(current, &header, sizeof(ANIMATION));
+		current += sizeof(ANIMATION);
+		memcpy(current, name, strlen(name) + 1);
+		current += strlen(name) + 1;
+		ANIMATION_CHANNEL* channels = (ANIMATION_CHANNEL*)current;
+		current += sizeof(ANIMATION_CHANNEL) * channelNum;
+		for (unsigned int i = 0; i < channelNum; i++) {
+			const char* nodeName = rawAnimation->channels[i].nodeName;
+			channels[i] = {};
+			memcpy(current, nodeName, strlen(nodeName) + 1);
+			current += strlen(nodeName) + 1;
+		}
+
+		delete[] (char*)rawAnimation;
+		rawAnimation = GetAnimationByMGObject(mgo);
+		modelNodeChannels.clear();
+		for (unsigned int i = 0; i < channelNum; i++) {
+			modelNodeChannels[rawAnimation->channels[i].nodeName] = rawAnimation->channels + i;
+		}
+		keysReleased = true;
+		return true;
+	}
+
+	bool Animation::IsKeyReleased() const
+	{
+		return keysReleased;
+	}
+
+	// rawAnimatioñobt@ƁAeۑ`̔z
+	size_t Animation::GetResidentBytes() const
+	{
+		size_t bytes = sizeof(ANIMATION) + (rawAnimation->name ? strlen(rawAnimation->name) + 1 : 0);
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			bytes += sizeof(ANIMATION_CHANNEL) + sizeof(VECTOR_KEY) * (channel.positionKeyNum + channel.scalingKeyNum) + sizeof(QUATERNION_KEY) * channel.rotationKeyNum;
+			bytes += strlen(channel.nodeName) + 1;
+		}
+		bytes += sizeof(float) * resampledData.capacity() + sizeof(RESAMPLED_CHANNEL) * resampledChannels.capacity();
+		bytes += sizeof(float) * compressedFloats.capacity() + sizeof(unsigned short) * compressedData.capacity() + sizeof(COMPRESSED_CHANNEL) * compressedChannels.capacity();
+		bytes += sizeof(F3) * cubicVectorTangents.capacity() + sizeof(Quaternion) * cubicRotationTangents.capacity() + sizeof(CUBIC_CHANNEL) * cubicChannels.capacity();
+		bytes += sizeof(F3) * rootMotionPositions.capacity() + sizeof(float) * rootMotionYaws.capacity();
+		return bytes;
+	}
+
+
+	// =======================================================
+	// ʂƐx̔r
+	// ݂̕ۑ`1/4t[݂ŃL[t[Ɣׂ
+	// L[t[́AOɑʁiresidentBytes̒lj
+	// =======================================================
+	ANIMATION_STORAGE_REPORT Animation::GetStorageReport() const
+	{
+		if (keysReleased) {
+			ANIMATION_STORAGE_REPORT report = releasedKeyReport;
+			report.residentBytes = GetResidentBytes();
+			return report;
+		}
+
+		ANIMATION_STORAGE_REPORT report = {};
+		report.residentBytes = GetResidentBytes();
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			const ANIMATION_CHANNEL& channel = rawAnimation->channels[i];
+			report.keyBytes += sizeof(ANIMATION_CHANNEL) + sizeof(VECTOR_KEY) * (channel.positionKeyNum + channel.scalingKeyNum) + sizeof(QUATERNION_KEY) * channel.rotationKeyNum;
+		}
+
+		if (!compressedChannels.empty()) {
+			report.bytes = sizeof(float) * compressedFloats.size() + sizeof(unsigned short) * compressedData.size() + sizeof(COMPRESSED_CHANNEL) * compressedChannels.size();
+		}
+		else if (!resampledChannels.empty()) {
+			report.bytes = sizeof(float) * resampledData.size() + sizeof(RESAMPLED_CHANNEL) * resampledChannels.size();
+		}
+		else if (!cubicChannels.empty()) {
+			report.bytes = report.keyBytes + sizeof(F3) * cubicVectorTangents.size() + sizeof(Quaternion) * cubicRotationTangents.size() + sizeof(CUBIC_CHANNEL) * cubicChannels.size();
+		}
+		else {
+			report.bytes = report.keyBytes;
+			return report;
+		}
+
+		for (unsigned int i = 0; i < rawAnimation->channelNum; i++) {
+			for (float frame = 0.0f; frame <= rawAnimation->frames; frame += 0.25f) {
+				F3 keySize = {}, keyPosition = {}, size = {}, position = {};
+				Quaternion keyRotate = {}, rotate = {};
+				ApplyAnimation(rawAnimation->channels + i, frame, &keySize, &keyPosition, &keyRotate);
+				ApplyChannel(i, frame, &size, &position, &rotate);
+				report.maxPositionError = std::max(report.maxPositionError, Distance(keyPosition, position));
+				report.maxScalingError = std::max(report.maxScalingError, Distance(keySize, size));
+				report.maxRotationError = std::max(report.maxRotationError, RotationDifference(keyRotate, rotate));
+			}
+		}
+		return report;
+	}
+
+
+	// =======================================================
+	// [g[V̒oiǂݍݎɈ񂾂j
+	// [gm[h̐ړƃ[𐮐t[Ƃ̃gbNɈڂA
+	// L[t[͎菜it[0̒lɌŒA㉺ړƌX͎cj
+	// FBXŕꂽm[h́uO_$AssimpFbx$_Translation / _RotationvT
+	// L[̂ŁATvOEkEOԂ̑OɌĂ
+	// \[XgSɌ߁AʂLoadAnimationrootMotionŕʂ̃\[XƂēǂݍ
+	// oς݂Ȃ瓯m[ĥƂtrue
+	// =======================================================
+	static ANIMATION_CHANNEL* FindRootMotionChannel(const std::unordered_map<std::string, ANIMATION_CHANNEL*>& channels, const std::string& nodeName, const char* suffix)
+	{
+		auto itr = channels.find(nodeName);
+		if (itr == channels.end()) {
+			itr = channels.find(nodeName + "_$AssimpFbx$_" + suffix);
+		}
+		return (itr == channels.end()) ? nullptr : itr->second;
+	}
+
+	// Y̐iXCOEcCXg̃cCXgj
+	static Quaternion GetYawTwist(const Quaternion& q)
+	{
+		float length = sqrtf(q.y * q.y + q.w * q.w);
+		if (length < 1e-6f) {
+			return Quaternion::Identity();
+		}
+		return { 0.0f, q.y / length, 0.0f, q.w / length };
+	}
+
+	static float GetYawAngle(const Quaternion& twist)
+	{
+		return 2.0f * atan2f(twist.y, twist.w);
+	}
+
+	bool Animation::ExtractRootMotion(const std::string& nodeName)
+	{
+		if (HasRootMotion()) {
+			return nodeName == rootMotionNode;
+		}
+		if (!resampledChannels.empty() || !compressedChannels.empty() || !cubicChannels.empty()) {
+			return false;
+		}
+		ANIMATION_CHANNEL* positionChannel = FindRootMotionChannel(modelNodeChannels, nodeName, "Translation");
+		ANIMATION_CHANNEL* rotationChannel = FindRootMotionChannel(modelNodeChannels, nodeName, "Rotation");
+		if (positionChannel && !positionChannel->positionKeyNum) {
+			positionChannel = nullptr;
+		}
+		if (rotationChannel && !rotationChannel->rotationKeyNum) {
+			rotationChannel = nullptr;
+		}
+		if (!positionChannel && !rotationChannel) {
+			return false;
+		}
+
+		// OɃTvO
+		const float frames = std::max(rawAnimation->frames, 0.0f);
+		const unsigned int sampleNum = (unsigned int)ceilf(frames) + 1;
+		F3 basePosition = {};
+		Quaternion baseTwist = Quaternion::Identity();
+		if (positionChannel) {
+			ApplyAnimation(positionChannel, 0.0f, nullptr, &basePosition, nullptr);
+		}
+		if (rotationChannel) {
+			Quaternion rotate = {};
+			ApplyAnimation(rotationChannel, 0.0f, nullptr, nullptr, &rotate);
+			baseTwist = GetYawTwist(rotate);
+		}
+
+		rootMotionPositions.resize(sampleNum);
+		rootMotionYaws.resize(sampleNum);
+		CHANNEL_CURSOR positionCursor = {}, rotationCursor = {};
+		float previousYaw = 0.0f;
+		for (unsigned int s = 0; s < sampleNum; s++) {
+			const float frame = std::min((float)s, frames);
+			F3 position = basePosition;
+			float yaw = 0.0f;
+			if (positionChannel) {
+				ApplyAnimation(positionChannel, frame, nullptr, &position, nullptr, &positionCursor);
+			}
+			if (rotationChannel) {
+				Quaternion rotate = {};
+				ApplyAnimation(rotationChannel, frame, nullptr, nullptr, &rotate, &rotationCursor);
+				yaw = GetYawAngle(baseTwist.Inverse() * GetYawTwist(rotate));
+				// }΂܂łA悤
+				while (yaw - previousYaw > PI) yaw -= 2.0f * PI;
+				while (yaw - previousYaw < -PI) yaw += 2.0f * PI;
 			}
-			else {
-				rotate = minKey->rotate;
+			previousYaw = yaw;
+
+			// 菜[̓LN^[_̉ŉ񂷂̂ŁA
+			// cʒuit[0̐ʒujȂ_𓮂
+			F3 remain = Rotate({ basePosition.x, 0.0f, basePosition.z }, Quaternion::AxisYRadian(yaw));
+			rootMotionPositions[s] = { position.x - remain.x, 0.0f, position.z - remain.z };
+			rootMotionYaws[s] = yaw;
+		}
+
+		// L[t[菜
+		if (positionChannel) {
+			for (unsigned int k = 0; k < positionChannel->positionKeyNum; k++) {
+				positionChannel->positionKeys[k].vector.x = basePosition.x;
+				positionChannel->positionKeys[k].vector.z = basePosition.z;
+			}
+		}
+		if (rotationChannel) {
+			for (unsigned int k = 0; k < rotationChannel->rotationKeyNum; k++) {
+				Quaternion& rotate = rotationChannel->rotationKeys[k].rotate;
+				rotate = Normalize(baseTwist * GetYawTwist(rotate).Inverse() * rotate);
+			}
+		}
+		rootMotionNode = nodeName;
+		return true;
+	}
+
+	bool Animation::HasRootMotion() const
+	{
+		return !rootMotionYaws.empty();
+	}
+
+	// t[̃gbN`
+	void Animation::SampleRootMotion(float frame, F3& position, float& yaw) const
+	{
+		const float frames = std::max(rawAnimation->frames, 0.0f);
+		frame = std::min(std::max(frame, 0.0f), frames);
+		const unsigned int s0 = std::min((unsigned int)frame, (unsigned int)rootMotionYaws.size() - 1);
+		const unsigned int s1 = std::min(s0 + 1, (unsigned int)rootMotionYaws.size() - 1);
+		const float span = std::min((float)s1, frames) - (float)s0;
+		const float t = (span > 0.0f) ? (frame - (float)s0) / span : 0.0f;
+		position = rootMotionPositions[s0] + (rootMotionPositions[s1] - rootMotionPositions[s0]) * t;
+		yaw = rootMotionYaws[s0] + (rootMotionYaws[s1] - rootMotionYaws[s0]) * t;
+	}
+
+
+	// =======================================================
+	// ̃t[Ԃ̃[g[V
+	// frame0̌ɂړƉ]ԂA[vȂI[܂ł悢
+	// iframe1 < frame0͈Aframe1 > frames͉łj
+	// ʂLN^[݂̌̌ŉ񂵂đA[
+	// =======================================================
+	ROOT_MOTION_DELTA Animation::GetRootMotionDelta(float frame0, float frame1, bool loop) const
+	{
+		ROOT_MOTION_DELTA delta = {};
+		if (!HasRootMotion()) {
+			return delta;
+		}
+		const float frames = std::max(rawAnimation->frames, 0.0f);
+		auto addSegment = [this, &delta](float from, float to) {
+			F3 position0, position1;
+			float yaw0, yaw1;
+			SampleRootMotion(from, position0, yaw0);
+			SampleRootMotion(to, position1, yaw1);
+			// from_̌ɒĂA܂ł̉]|đ
+			F3 move = Rotate(position1 - position0, Quaternion::AxisYRadian(-yaw0));
+			delta.position += Rotate(move, Quaternion::AxisYRadian(delta.yaw));
+			delta.yaw += yaw1 - yaw0;
+		};
+
+		if (!loop || frames <= 0.0f) {
+			addSegment(frame0, frame1);
+			return delta;
+		}
+		if (frame1 < frame0) {
+			frame1 += frames;
+		}
+		while (frame1 > frames) {
+			addSegment(frame0, frames);
+			frame0 = 0.0f;
+			frame1 -= frames;
+		}
+		addSegment(frame0, frame1);
+		return delta;
+	}
+
+
+	// =======================================================
+	// `l̃J[\擾
+	// Aj[Vςꍇ͑S`lZbg
+	// =======================================================
+	CHANNEL_CURSOR* AnimationCursor::GetChannelCursor(const Animation* animation, unsigned int channelIndex)
+	{
+		if (this->animation != animation) {
+			this->animation = animation;
+			channelCursors.assign(animation->rawAnimation->channelNum, {});
+		}
+		return &channelCursors[channelIndex];
+	}
+
+	void AnimationCursor::Reset()
+	{
+		for (CHANNEL_CURSOR& channelCursor : channelCursors) {
+			channelCursor = {};
+		}
+	}
+
+
+	// =======================================================
+	// f̊em[hɑΉ`lOɒTĂ
+	// =======================================================
+	AnimationBinding::AnimationBinding(const Model* model, const Animation* animation)
+		: model(model), animation(animation), nodeChannels(GetModelNodeNum(model->rawModel->rootNode), ANIMATION_BINDING_NONE)
+	{
+		for (unsigned int i = 0; i < nodeChannels.size(); i++) {
+			auto itr = animation->modelNodeChannels.find(model->rawModel->rootNode[i].name);
+			if (itr != animation->modelNodeChannels.end()) {
+				nodeChannels[i] = (unsigned int)(itr->second - animation->rawAnimation->channels);
 			}
 		}
 	}
 
+	const Model* AnimationBinding::GetModel() const
+	{
+		return model;
+	}
+
+	const Animation* AnimationBinding::GetAnimation() const
+	{
+		return animation;
+	}
+
+	unsigned int AnimationBinding::GetChannelIndex(unsigned int nodeIndex) const
+	{
+		return (nodeIndex < nodeChannels.size()) ? nodeChannels[nodeIndex] : ANIMATION_BINDING_NONE;
+	}
+
+	unsigned int AnimationBinding::GetChannelIndex(const MODEL_NODE* node) const
+	{
+		return GetChannelIndex(model->GetNodeIndex(node));
+	}
+
 
 	// =======================================================
 	// w肵\[XXR[vǉ
@@ -133,6 +888,23 @@ namespace MG {
 	}
 
 
+	// =======================================================
+	// 郂fEAj[V܂ޑΉ\폜
+	// =======================================================
+	void ResourceTool::__ReleaseAnimationBindings(const Resource* resource)
+	{
+		for (auto itr = __animationBindings.begin(); itr != __animationBindings.end();) {
+			if ((const Resource*)itr->first.first == resource || (const Resource*)itr->first.second == resource) {
+				delete itr->second;
+				itr = __animationBindings.erase(itr);
+			}
+			else {
+				itr++;
+			}
+		}
+	}
+
+
 	// =======================================================
 	// w肵eNX`XR[v
 	// =======================================================
@@ -224,9 +996,29 @@ namespace MG {
 		}
 	}
 
-	void ResourceTool::ReleaseAnimation(const std::string& path, const std::string& scope)
+	// =======================================================
+	// Aj[ṼL[
+	// ǂݍ݃[hA[g[Ṽm[hƂɕʂ̃Aj[VƂĎit@CłL[Ⴄj
+	// [g[VȂANIMATION_LOAD_MODE_KEY͂ق̃\[XƓpX
+	// =======================================================
+	HASH ResourceTool::GetAnimationKey(const std::string& path, ANIMATION_LOAD_MODE mode, const std::string& rootMotion)
 	{
-		const HASH key = strToHash(path);
+		if (!rootMotion.empty()) {
+			return strToHash("animation:" + std::to_string((int)mode) + ":rootMotion:" + rootMotion + ":" + path);
+		}
+		if (mode == ANIMATION_LOAD_MODE_KEY) {
+			return strToHash(path);
+		}
+		return strToHash("animation:" + std::to_string((int)mode) + ":" + path);
+	}
+
+	// =======================================================
+	// w肵Aj[VXR[v
+	// ǂݍ񂾂ƂƓ[hA[g[Ṽm[hw肷
+	// =======================================================
+	void ResourceTool::ReleaseAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode, const std::string& rootMotion)
+	{
+		const HASH key = GetAnimationKey(path, mode, rootMotion);
 		if (__resources[key].resource && __resources[key].resource->GetType() == Animation::TYPE) {
 			ReleaseResource(key, scope);
 		}
@@ -242,12 +1034,25 @@ namespace MG {
 	}
 
 
+	// =======================================================
+	// fƃAj[V̑Ή\擾îݍ쐬j
+	// =======================================================
+	const AnimationBinding* ResourceTool::GetAnimationBinding(const Model* model, const Animation* animation)
+	{
+		AnimationBinding*& binding = __animationBindings[{ model, animation }];
+		if (!binding) {
+			binding = new AnimationBinding(model, animation);
+		}
+		return binding;
+	}
+
+
 	// =======================================================
 	// w肵\[XXR[v
 	// =======================================================
 	void ResourceTool::ReleaseResource(const std::string& path, const std::string& scope)
 	{
-		ReleaseResource(strToHash(path), scope);
+		ReleaseResource((HASH)strToHash(path), scope);
 	}
 
 
@@ -268,6 +1073,7 @@ namespace MG {
 			}
 
 			if (__resources[key].scope.size() == 0) {
+				__ReleaseAnimationBindings(__resources[key].resource);
 				__ReleaseResource(key);
 			}
 		}
@@ -301,6 +1107,10 @@ namespace MG {
 	// =======================================================
 	void ResourceTool::ReleaseAllResource()
 	{
+		for (const auto& pair : __animationBindings) {
+			delete pair.second;
+		}
+		__animationBindings.clear();
 		for (const auto& pair : __resources) {
 			if (pair.second.resource) {
 				__ReleaseResource(pair.first);
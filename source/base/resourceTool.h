@@ -10,6 +10,7 @@
 
 #include "MGCommon.h"
 #include "MGDataType.h"
+#include "animationEvent.h"
 
 namespace MG {
 	//constexpr const char* RESOURCE_SCOPE_GOBAL = "gobal";
@@ -26,6 +27,7 @@ namespace MG {
 		const HASH key;
 	public:
 		Resource(const HASH key);
+		virtual ~Resource() = default;
 		virtual HASH GetType() = 0;
 		HASH GetKey();
 	};
@@ -49,25 +51,100 @@ namespace MG {
 		HASH GetType() override;
 	};
 
+	static constexpr unsigned int NODE_PARENT_NONE = 0xFFFFFFFF;
+
 	class Model : public Resource {
 	public:
 		static HASH TYPE;
 		MODEL* rawModel;
+		unsigned int nodeNum = 0;	// m[hrootNodeAĕł
+		std::vector<unsigned int> parentIndexes;	// ẽm[hԍAe͕KqO
 		std::map<MESH*, Texture*> meshTextures;
 
 		Model(const HASH key);
+		void LoadNodeHierarchy();
+		unsigned int GetNodeIndex(const MODEL_NODE* node) const;
 		HASH GetType() override;
 	};
 
 	class Animation : public Resource {
+	private:
+		std::vector<float> resampledData;
+		std::vector<RESAMPLED_CHANNEL> resampledChannels;
+		std::vector<float> compressedFloats;
+		std::vector<unsigned short> compressedData;
+		std::vector<COMPRESSED_CHANNEL> compressedChannels;
+		COMPRESSED_ANIMATION compressedAnimation;
+		std::vector<F3> cubicVectorTangents;
+		std::vector<Quaternion> cubicRotationTangents;
+		std::vector<CUBIC_CHANNEL> cubicChannels;
+		std::vector<F3> rootMotionPositions;	// t[Ƃ̃LN^[_it[0Aʁj
+		std::vector<float> rootMotionYaws;		// t[Ƃ̃[it[0AAj
+		std::string rootMotionNode;				// om[h
+		bool keysReleased = false;
+		ANIMATION_STORAGE_REPORT releasedKeyReport;	// L[t[Oɑ
+		void SampleRootMotion(float frame, F3& position, float& yaw) const;
+		size_t GetResidentBytes() const;
 	public:
 		static HASH TYPE;
 		ANIMATION* rawAnimation;
 		std::unordered_map<std::string, ANIMATION_CHANNEL*> modelNodeChannels;
+		AnimationEventTrack events;
 
 		Animation(const HASH key);
 		HASH GetType() override;
-		void Apply(const std::string& nodeName, float frame, F3& size, F3& position, Quaternion& rotate);
+		void Apply(const std::string& nodeName, float frame, F3& size, F3& position, Quaternion& rotate, AnimationCursor* cursor = nullptr) const;
+		void ApplyChannel(unsigned int channelIndex, float frame, F3* size, F3* position, Quaternion* rotate, AnimationCursor* cursor = nullptr) const;
+		void Resample();
+		bool IsResampled() const;
+		void Compress(const ANIMATION_ERROR_BUDGET& budget = {}, const std::unordered_map<std::string, ANIMATION_ERROR_BUDGET>* nodeBudgets = nullptr);
+		bool IsCompressed() const;
+		void ComputeCubicTangents();
+		bool IsCubic() const;
+		bool ReleaseKeys();
+		bool IsKeyReleased() const;
+		ANIMATION_STORAGE_REPORT GetStorageReport() const;
+		bool ExtractRootMotion(const std::string& nodeName);
+		bool HasRootMotion() const;
+		ROOT_MOTION_DELTA GetRootMotionDelta(float frame0, float frame1, bool loop = true) const;
+	};
+
+	// =======================================================
+	// Aj[ṼL[TJ[\
+	// 
+	// `lƂɑÕL[ԂLāA
+	// Đ̒TpO(1)ɂ
+	// ĐAj[VƂɈ
+	// =======================================================
+	class AnimationCursor {
+	private:
+		const Animation* animation = nullptr;
+		std::vector<CHANNEL_CURSOR> channelCursors;
+	public:
+		CHANNEL_CURSOR* GetChannelCursor(const Animation* animation, unsigned int channelIndex);
+		void Reset();
+	};
+
+	// =======================================================
+	// fƃAj[V̑Ή\
+	// 
+	// m[hԍirootNodëʒuj`lԍ
+	// t[̃m[h𐮐̎QƂɒu
+	// ResourceTool::GetAnimationBindingőgݍ킹ƂɈ쐬
+	// =======================================================
+	static constexpr unsigned int ANIMATION_BINDING_NONE = 0xFFFFFFFF;
+
+	class AnimationBinding {
+	private:
+		const Model* model;
+		const Animation* animation;
+		std::vector<unsigned int> nodeChannels;
+	public:
+		AnimationBinding(const Model* model, const Animation* animation);
+		const Model* GetModel() const;
+		const Animation* GetAnimation() const;
+		unsigned int GetChannelIndex(unsigned int nodeIndex) const;
+		unsigned int GetChannelIndex(const MODEL_NODE* node) const;
 	};
 
 	class ResourceTool {
@@ -75,8 +152,10 @@ namespace MG {
 		std::hash<std::string> strToHash{};
 		std::hash<std::wstring> wstrToHash{};
 		map<HASH, RESOURCE_NOTE> __resources;
+		map<std::pair<const Model*, const Animation*>, AnimationBinding*> __animationBindings;
 		virtual void __ReleaseResource(const HASH key) = 0;
 		void __AddScope(const HASH key, const string& scope);
+		void __ReleaseAnimationBindings(const Resource* resource);
 	public:
 		virtual Texture* LoadTexture(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL) = 0;
 		virtual Texture* LoadTexture(unsigned int resourceId, const std::string& scope = RESOURCE_SCOPE_GOBAL) = 0;
@@ -95,10 +174,14 @@ namespace MG {
 		void ReleaseModel(const std::string& path, const std::string& scope);
 		void ReleaseModel(const std::string& scope);
 
-		virtual Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL) = 0;
-		void ReleaseAnimation(const std::string& path, const std::string& scope);
+		// rootMotion̓[g[V𔲂om[hiȂ甲oȂjA[hƓL[Ɋ܂߂
+		virtual Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL, ANIMATION_LOAD_MODE mode = ANIMATION_LOAD_MODE_KEY, const std::string& rootMotion = "") = 0;
+		HASH GetAnimationKey(const std::string& path, ANIMATION_LOAD_MODE mode, const std::string& rootMotion = "");
+		void ReleaseAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode = ANIMATION_LOAD_MODE_KEY, const std::string& rootMotion = "");
 		void ReleaseAnimation(const std::string& scope);
 
+		const AnimationBinding* GetAnimationBinding(const Model* model, const Animation* animation);
+
 		void ReleaseResource(const std::string& path, const std::string& scope);
 		void ReleaseResource(unsigned int resourceId, const std::string& scope);
 		void ReleaseResource(const HASH key, const std::string& scope);
@@ -28,6 +28,25 @@ namespace MG {
 	AudioDX::AudioDX(const HASH key, BYTE* soundData, WAVEFORMATEX waveFormatEX, int length, int playLength) :
 		Audio(key), soundData(soundData), waveFormatEX(waveFormatEX), length(length), playLength(playLength) {}
 
+	// Ȃobt@
+	static ID3D11Buffer* CreateStaticBuffer(ID3D11Device* pDevice, const void* source, UINT byteWidth, UINT bindFlags)
+	{
+		D3D11_BUFFER_DESC bd = {};
+		bd.Usage = D3D11_USAGE_DEFAULT;
+		bd.ByteWidth = byteWidth;
+		bd.BindFlags = bindFlags;
+		bd.CPUAccessFlags = 0;
+
+		D3D11_SUBRESOURCE_DATA data;
+		data.pSysMem = source;
+		data.SysMemPitch = 0;
+		data.SysMemSlicePitch = 0;
+
+		ID3D11Buffer* buffer;
+		pDevice->CreateBuffer(&bd, &data, &buffer);
+		return buffer;
+	}
+
 	ModelDX::ModelDX(const HASH key) : Model(key) {}
 
 
@@ -81,20 +100,27 @@ namespace MG {
 				}
 				
 			}
+			for (auto& meshPartition : model->meshPartitions) {
+				for (MESH_PARTITION_DX& partition : meshPartition.second) {
+					partition.vertexBuffer->Release();
+					partition.boneWeightBuffer->Release();
+					partition.indexBuffer->Release();
+				}
+			}
 			ReleaseTexture(std::to_string(key));
 			model->vertexBuffers.clear();
 			model->indexBuffers.clear();
 			model->boneWeightBuffers.clear();
 			model->meshBones.clear();
+			model->meshPartitions.clear();
 			model->meshTextures.clear();
-			model->rawModel;
-			delete model->rawModel;
+			delete[] (char*)model->rawModel;
 			delete model;
 		}
 		else if (type == Animation::TYPE) {
 			Animation* animation = (Animation*)__resources[key].resource;
 			animation->modelNodeChannels.clear();
-			delete animation->rawAnimation;
+			delete[] (char*)animation->rawAnimation;
 			delete animation;
 		}
 
@@ -401,6 +427,7 @@ namespace MG {
 			MODEL* rawModel = GetModelByMGObject(mgo);
 			ModelDX* model = new ModelDX(key);
 			model->rawModel = rawModel;
+			model->LoadNodeHierarchy();
 			for (int i = 0; i < rawModel->textureNum; i++) {
 				TEXTURE& texture = rawModel->textures[i];
 				const HASH textureKey = strToHash(texture.textureStr);
@@ -464,13 +491,13 @@ namespace MG {
 				}
 
 				{
-					LoadNodeWorldTransforms(model->rawModel->rootNode, M4x4::TranslatingMatrix({}), model->nodeWorldTransforms);
+					LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), model->bindPose);
 				}
 
 				std::unordered_map<std::string, MODEL_NODE*> nameNodeMap;
 
-				for (auto& keyPair : model->nodeWorldTransforms) {
-					nameNodeMap[keyPair.first->name] = keyPair.first;
+				for (unsigned int n = 0; n < model->nodeNum; n++) {
+					nameNodeMap[rawModel->rootNode[n].name] = rawModel->rootNode + n;
 				}
 
 				// {[
@@ -479,12 +506,35 @@ namespace MG {
 					for (int b = 0; b < mesh->boneNum; b++) {
 						MODEL_NODE* node = nameNodeMap[mesh->bones[b].name];
 						model->meshBones[mesh].push_back({
-							mesh->bones[b].transform,
-							model->nodeWorldTransforms[node],
+							M3x4::FromM4x4(mesh->bones[b].transform),
 							node
 						});
 					}
 				}
+
+				// pbgɓ肫ȂbV͕bVɕ
+				if (mesh->boneNum > SKIN_PALETTE_MAX) {
+					std::vector<BONE_PARTITION> partitions;
+					if (PartitionMeshBones(mesh, SKIN_PALETTE_MAX, partitions)) {
+						std::vector<MESH_PARTITION_DX>& meshPartitions = model->meshPartitions[mesh];
+						meshPartitions.reserve(partitions.size());
+						for (const BONE_PARTITION& partition : partitions) {
+							MESH_PARTITION_DX partitionDX = {};
+							partitionDX.vertexBuffer = CreateStaticBuffer(pDevice, partition.vertices.data(),
+								(UINT)(sizeof(VERTEX) * partition.vertices.size()), D3D11_BIND_VERTEX_BUFFER);
+							partitionDX.boneWeightBuffer = CreateStaticBuffer(pDevice, partition.boneWeights.data(),
+								(UINT)(sizeof(VERTEX_BONE_WEIGHT) * partition.boneWeights.size()), D3D11_BIND_VERTEX_BUFFER);
+							partitionDX.indexBuffer = CreateStaticBuffer(pDevice, partition.vertexIndexes.data(),
+								(UINT)(sizeof(unsigned int) * partition.vertexIndexes.size()), D3D11_BIND_INDEX_BUFFER);
+							partitionDX.vertexIndexNum = (unsigned int)partition.vertexIndexes.size();
+							partitionDX.bones.reserve(partition.bones.size());
+							for (unsigned int b : partition.bones) {
+								partitionDX.bones.push_back(model->meshBones[mesh][b]);
+							}
+							meshPartitions.push_back(std::move(partitionDX));
+						}
+					}
+				}
 				
 				// CfbNobt@
 				{
@@ -522,9 +572,14 @@ namespace MG {
 		return nullptr;
 	}
 
-	Animation* ResourceToolDX::LoadAnimation(const std::string& path, const std::string& scope)
+	// =======================================================
+	// Aj[V\[X擾
+	// ǂݍ݃[h̓LbṼL[Ɋ܂߂
+	// t@C[hςēǂݍނƁAʂAnimationɂȂ
+	// =======================================================
+	Animation* ResourceToolDX::LoadAnimation(const std::string& path, const std::string& scope, ANIMATION_LOAD_MODE mode, const std::string& rootMotion)
 	{
-		const HASH key = strToHash(path);
+		const HASH key = GetAnimationKey(path, mode, rootMotion);
 		if (!__resources[key].resource) {
 			MGObject mgo = LoadMGO(path.c_str());
 			ANIMATION* rawAnimation = GetAnimationByMGObject(mgo);
@@ -535,7 +590,22 @@ namespace MG {
 				const char* nodeName = rawAnimation->channels[i].nodeName;
 				animation->modelNodeChannels[nodeName] = (rawAnimation->channels + i);
 			}
-			
+			animation->events.Load(GetAnimationEventPath(path));
+			// L[̂ŁATvOEk̑O
+			if (!rootMotion.empty()) {
+				animation->ExtractRootMotion(rootMotion);
+			}
+			if (mode == ANIMATION_LOAD_MODE_RESAMPLE) {
+				animation->Resample();
+				animation->ReleaseKeys();
+			}
+			else if (mode == ANIMATION_LOAD_MODE_COMPRESS) {
+				animation->Compress();
+				animation->ReleaseKeys();
+			}
+			else if (mode == ANIMATION_LOAD_MODE_CUBIC) {
+				animation->ComputeCubicTangents();
+			}
 
 			__resources[key].resource = animation;
 		}
@@ -9,7 +9,9 @@
 #define _RESOURCE_TOOL_DX_H
 
 #include "resourceTool.h"
+#include "pose.h"
 #include "rendererDX.h"
+#include "bonePartition.h"
 #include <xaudio2.h>
 #include <d2d1.h>
 #include <dwrite.h>
@@ -40,6 +42,15 @@ namespace MG {
 		int playLength;
 	};
 
+	// {[SKIN_PALETTE_MAX𒴂郁bV̕bViPartitionMeshBonešʁj
+	struct MESH_PARTITION_DX {
+		ID3D11Buffer* vertexBuffer;
+		ID3D11Buffer* boneWeightBuffer;
+		ID3D11Buffer* indexBuffer;
+		unsigned int vertexIndexNum;
+		std::vector<MESH_BONE> bones;
+	};
+
 	// =======================================================
 	// DirectX̃f\[X
 	// =======================================================
@@ -50,7 +61,8 @@ namespace MG {
 		std::map<MESH*, ID3D11Buffer*> boneWeightBuffers;
 		std::map<MESH*, ID3D11Buffer*> indexBuffers;
 		std::map<MESH*, std::vector<MESH_BONE>> meshBones;
-		std::map<MODEL_NODE*, M4x4> nodeWorldTransforms;
+		std::map<MESH*, std::vector<MESH_PARTITION_DX>> meshPartitions;
+		Pose bindPose;
 		ModelDX(const HASH key);
 	};
 
@@ -72,7 +84,7 @@ namespace MG {
 		Audio* LoadAudio(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL) override;
 		Audio* LoadAudio(unsigned int resourceId, const std::string& scope = RESOURCE_SCOPE_GOBAL) override;
 		Model* LoadModel(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL) override;
-		Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL) override;
+		Animation* LoadAnimation(const std::string& path, const std::string& scope = RESOURCE_SCOPE_GOBAL, ANIMATION_LOAD_MODE mode = ANIMATION_LOAD_MODE_KEY, const std::string& rootMotion = "") override;
 	};
 
 } // namespace MG
@@ -25,6 +25,7 @@
 #include "gameObjectAudio.h"
 #include "camera.h"
 #include "resourceTool.h"
+#include "pose.h"
 #include "collision.h"
 #include "renderer.h"
 
@@ -0,0 +1,351 @@
+// =======================================================
+// skinning.cpp
+//
+// XLjOp̃{[sACPUXLjO
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "skinning.h"
+#include "resourceTool.h"
+#include "animationKernel.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define SKINNING_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#define SKINNING_TARGET_AVX2
+#else
+#define SKINNING_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace MG {
+
+	// xɎ钸_
+	static constexpr unsigned int SKINNING_CHUNK = 256;
+
+	void BuildSkinPalette(const Model* model, const Pose& pose, const MESH_BONE* bones, unsigned int boneNum, M3x4* palette)
+	{
+		const M3x4* worlds = pose.GetWorlds();
+		for (unsigned int b = 0; b < boneNum; b++) {
+			palette[b] = bones[b].offset * worlds[model->GetNodeIndex(bones[b].node)];
+		}
+	}
+
+
+	// =======================================================
+	// XJ[
+	// 4{̃{[sd݂ōĂAʒuƖ@Ɉ񂸂|
+	// =======================================================
+	static void SkinVerticesScalar(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int begin, unsigned int end,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		for (unsigned int i = begin; i < end; i++) {
+			const VERTEX_BONE_WEIGHT& boneWeight = boneWeights[i];
+			M3x4 skin = {};
+			float* dest = &skin._v00;
+			for (int k = 0; k < 4; k++) {
+				const float* src = &palette[boneWeight.boneIndexes[k]]._v00;
+				float weight = boneWeight.weights[k];
+				for (int e = 0; e < 12; e++) {
+					dest[e] += src[e] * weight;
+				}
+			}
+			positions[i] = skin * vertices[i].position;
+			if (normals) {
+				normals[i] = Normalize(skin.TransformNormal(vertices[i].normal));
+			}
+		}
+	}
+
+#ifdef SKINNING_X86
+
+	// =======================================================
+	// SSEi1_As1s1WX^ōj
+	// s]uėɂÃu[hLXgŕϊ
+	// =======================================================
+	static inline void StoreF3(F3& dest, __m128 v)
+	{
+		float temp[4];
+		_mm_storeu_ps(temp, v);
+		dest = { temp[0], temp[1], temp[2] };
+	}
+
+	// 0Ȃ炻̂܂܁iNormalizeƓj
+	static inline __m128 Normalize3(__m128 v)
+	{
+		__m128 dot = _mm_mul_ps(v, v);
+		dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+		dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 length = _mm_sqrt_ps(dot);
+		__m128 inv = _mm_and_ps(_mm_cmpgt_ps(length, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), length));
+		return _mm_mul_ps(v, inv);
+	}
+
+	static void SkinVerticesSSE(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int begin, unsigned int end,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		for (unsigned int i = begin; i < end; i++) {
+			const VERTEX_BONE_WEIGHT& boneWeight = boneWeights[i];
+			__m128 row0 = _mm_setzero_ps();
+			__m128 row1 = _mm_setzero_ps();
+			__m128 row2 = _mm_setzero_ps();
+			for (int k = 0; k < 4; k++) {
+				const M3x4& bone = palette[boneWeight.boneIndexes[k]];
+				__m128 weight = _mm_set1_ps(boneWeight.weights[k]);
+				row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_loadu_ps(&bone._v00), weight));
+				row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_loadu_ps(&bone._v10), weight));
+				row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_loadu_ps(&bone._v20), weight));
+			}
+			__m128 row3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);	// row0`2]gk̗Arow3sړ
+
+			const VERTEX& vertex = vertices[i];
+			__m128 position = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(row0, _mm_set1_ps(vertex.position.x)), _mm_mul_ps(row1, _mm_set1_ps(vertex.position.y))),
+				_mm_add_ps(_mm_mul_ps(row2, _mm_set1_ps(vertex.position.z)), row3));
+			StoreF3(positions[i], position);
+			if (normals) {
+				__m128 normal = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(row0, _mm_set1_ps(vertex.normal.x)), _mm_mul_ps(row1, _mm_set1_ps(vertex.normal.y))),
+					_mm_mul_ps(row2, _mm_set1_ps(vertex.normal.z)));
+				StoreF3(normals[i], Normalize3(normal));
+			}
+		}
+	}
+
+
+	// =======================================================
+	// AVX2i2_A128rbg̏㉺1_j
+	// gSSEłƓ
+	// =======================================================
+	SKINNING_TARGET_AVX2 static inline __m256 Load2(const float* low, const float* high)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+	}
+
+	SKINNING_TARGET_AVX2 static inline __m256 Set2(float low, float high)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(low)), _mm_set1_ps(high), 1);
+	}
+
+	SKINNING_TARGET_AVX2 static inline __m256 Normalize3x2(__m256 v)
+	{
+		__m256 dot = _mm256_mul_ps(v, v);
+		dot = _mm256_add_ps(dot, _mm256_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+		dot = _mm256_add_ps(dot, _mm256_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m256 length = _mm256_sqrt_ps(dot);
+		__m256 inv = _mm256_and_ps(_mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_div_ps(_mm256_set1_ps(1.0f), length));
+		return _mm256_mul_ps(v, inv);
+	}
+
+	SKINNING_TARGET_AVX2 static void SkinVerticesAVX2(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int begin, unsigned int end,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		unsigned int i = begin;
+		for (; i + 2 <= end; i += 2) {
+			const VERTEX_BONE_WEIGHT& weight0 = boneWeights[i];
+			const VERTEX_BONE_WEIGHT& weight1 = boneWeights[i + 1];
+			__m256 row0 = _mm256_setzero_ps();
+			__m256 row1 = _mm256_setzero_ps();
+			__m256 row2 = _mm256_setzero_ps();
+			for (int k = 0; k < 4; k++) {
+				const M3x4& bone0 = palette[weight0.boneIndexes[k]];
+				const M3x4& bone1 = palette[weight1.boneIndexes[k]];
+				__m256 weight = Set2(weight0.weights[k], weight1.weights[k]);
+				row0 = _mm256_add_ps(row0, _mm256_mul_ps(Load2(&bone0._v00, &bone1._v00), weight));
+				row1 = _mm256_add_ps(row1, _mm256_mul_ps(Load2(&bone0._v10, &bone1._v10), weight));
+				row2 = _mm256_add_ps(row2, _mm256_mul_ps(Load2(&bone0._v20, &bone1._v20), weight));
+			}
+
+			// 128rbgƂɓ]u
+			__m256 row3 = _mm256_setzero_ps();
+			__m256 t0 = _mm256_unpacklo_ps(row0, row1);
+			__m256 t1 = _mm256_unpacklo_ps(row2, row3);
+			__m256 t2 = _mm256_unpackhi_ps(row0, row1);
+			__m256 t3 = _mm256_unpackhi_ps(row2, row3);
+			__m256 column0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 column1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			__m256 column2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 column3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+			const VERTEX& vertex0 = vertices[i];
+			const VERTEX& vertex1 = vertices[i + 1];
+			__m256 position = _mm256_add_ps(
+				_mm256_add_ps(_mm256_mul_ps(column0, Set2(vertex0.position.x, vertex1.position.x)), _mm256_mul_ps(column1, Set2(vertex0.position.y, vertex1.position.y))),
+				_mm256_add_ps(_mm256_mul_ps(column2, Set2(vertex0.position.z, vertex1.position.z)), column3));
+			StoreF3(positions[i], _mm256_castps256_ps128(position));
+			StoreF3(positions[i + 1], _mm256_extractf128_ps(position, 1));
+			if (normals) {
+				__m256 normal = _mm256_add_ps(
+					_mm256_add_ps(_mm256_mul_ps(column0, Set2(vertex0.normal.x, vertex1.normal.x)), _mm256_mul_ps(column1, Set2(vertex0.normal.y, vertex1.normal.y))),
+					_mm256_mul_ps(column2, Set2(vertex0.normal.z, vertex1.normal.z)));
+				normal = Normalize3x2(normal);
+				StoreF3(normals[i], _mm256_castps256_ps128(normal));
+				StoreF3(normals[i + 1], _mm256_extractf128_ps(normal, 1));
+			}
+		}
+		SkinVerticesSSE(vertices, boneWeights, i, end, palette, positions, normals);
+	}
+
+#endif
+
+	// =======================================================
+	// fANH[^jI
+	// =======================================================
+	DUAL_QUATERNION DualQuaternionFromMatrix(const M3x4& matrix)
+	{
+		F3 axisX = Normalize(F3{ matrix._v00, matrix._v10, matrix._v20 });
+		F3 axisY = Normalize(F3{ matrix._v01, matrix._v11, matrix._v21 });
+		F3 axisZ = Normalize(F3{ matrix._v02, matrix._v12, matrix._v22 });
+
+		// ]s񂩂NH[^jIiΊp̈ԑ傫Ƃ납狁߂Đxۂj
+		float m00 = axisX.x, m10 = axisX.y, m20 = axisX.z;
+		float m01 = axisY.x, m11 = axisY.y, m21 = axisY.z;
+		float m02 = axisZ.x, m12 = axisZ.y, m22 = axisZ.z;
+		float trace = m00 + m11 + m22;
+		Quaternion real;
+		if (trace > 0.0f) {
+			float s = sqrtf(trace + 1.0f) * 2.0f;
+			real = { (m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s };
+		}
+		else if (m00 > m11 && m00 > m22) {
+			float s = sqrtf(1.0f + m00 - m11 - m22) * 2.0f;
+			real = { 0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s };
+		}
+		else if (m11 > m22) {
+			float s = sqrtf(1.0f + m11 - m00 - m22) * 2.0f;
+			real = { (m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s };
+		}
+		else {
+			float s = sqrtf(1.0f + m22 - m00 - m11) * 2.0f;
+			real = { (m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s };
+		}
+		real = Normalize(real);
+
+		Quaternion translation = { matrix._v03, matrix._v13, matrix._v23, 0.0f };
+		Quaternion dual = translation * real;
+		return { real, { dual.x * 0.5f, dual.y * 0.5f, dual.z * 0.5f, dual.w * 0.5f } };
+	}
+
+	void BuildDualQuaternionPalette(const Model* model, const Pose& pose, const MESH_BONE* bones, unsigned int boneNum,
+		const M3x4& space, DUAL_QUATERNION* palette)
+	{
+		const M3x4* worlds = pose.GetWorlds();
+		M3x4 inverseSpace = space.Inverse();
+		for (unsigned int b = 0; b < boneNum; b++) {
+			palette[b] = DualQuaternionFromMatrix(bones[b].offset * worlds[model->GetNodeIndex(bones[b].node)] * inverseSpace);
+		}
+	}
+
+	static inline F3 Cross(float ax, float ay, float az, const F3& b)
+	{
+		return { ay * b.z - az * b.y, az * b.x - ax * b.z, ax * b.y - ay * b.x };
+	}
+
+	// 4{d݂ōiŏ̃{[ƋtȂ畄𔽓]jAŊĒPʂɂ
+	void SkinVerticesDualQuaternion(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+		const DUAL_QUATERNION* palette, const M3x4& space, F3* positions, F3* normals)
+	{
+		for (unsigned int i = 0; i < vertexNum; i++) {
+			const VERTEX_BONE_WEIGHT& boneWeight = boneWeights[i];
+			const Quaternion& pivot = palette[boneWeight.boneIndexes[0]].real;
+			float real[4] = {};
+			float dual[4] = {};
+			for (int k = 0; k < 4; k++) {
+				const DUAL_QUATERNION& bone = palette[boneWeight.boneIndexes[k]];
+				float weight = boneWeight.weights[k];
+				if (Dot(bone.real, pivot) < 0.0f) {
+					weight = -weight;
+				}
+				real[0] += bone.real.x * weight; real[1] += bone.real.y * weight; real[2] += bone.real.z * weight; real[3] += bone.real.w * weight;
+				dual[0] += bone.dual.x * weight; dual[1] += bone.dual.y * weight; dual[2] += bone.dual.z * weight; dual[3] += bone.dual.w * weight;
+			}
+			float length = sqrtf(real[0] * real[0] + real[1] * real[1] + real[2] * real[2] + real[3] * real[3]);
+			float inv = (length > 0.0f) ? 1.0f / length : 0.0f;
+			float rx = real[0] * inv, ry = real[1] * inv, rz = real[2] * inv, rw = real[3] * inv;
+			float dx = dual[0] * inv, dy = dual[1] * inv, dz = dual[2] * inv, dw = dual[3] * inv;
+
+			// ]Fp + 2 * r ~ (r ~ p + w * p)
+			// sړF2 * (rw * d - dw * r + r ~ d)
+			const F3& p = vertices[i].position;
+			F3 inner = Cross(rx, ry, rz, p) + p * rw;
+			F3 rotated = p + Cross(rx, ry, rz, inner) * 2.0f;
+			F3 translation = (F3{ dx, dy, dz } * rw - F3{ rx, ry, rz } * dw + Cross(rx, ry, rz, F3{ dx, dy, dz })) * 2.0f;
+			positions[i] = space * (rotated + translation);
+			if (normals) {
+				const F3& n = vertices[i].normal;
+				F3 innerNormal = Cross(rx, ry, rz, n) + n * rw;
+				normals[i] = Normalize(space.TransformNormal(n + Cross(rx, ry, rz, innerNormal) * 2.0f));
+			}
+		}
+	}
+
+
+	static void SkinVertexRange(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int begin, unsigned int end,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		switch (GetAnimationKernel()) {
+#ifdef SKINNING_X86
+		case ANIMATION_KERNEL_AVX2:
+			SkinVerticesAVX2(vertices, boneWeights, begin, end, palette, positions, normals);
+			return;
+		case ANIMATION_KERNEL_SSE:
+			SkinVerticesSSE(vertices, boneWeights, begin, end, palette, positions, normals);
+			return;
+#endif
+		default:
+			SkinVerticesScalar(vertices, boneWeights, begin, end, palette, positions, normals);
+			return;
+		}
+	}
+
+	void SkinVertices(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		SkinVertexRange(vertices, boneWeights, 0, vertexNum, palette, positions, normals);
+	}
+
+	void SkinMesh(const MESH* mesh, const M3x4* palette, F3* positions, F3* normals)
+	{
+		if (mesh->boneNum == 0) {
+			return;
+		}
+		SkinVertices(mesh->vertices, mesh->boneWeights, mesh->vertexNum, palette, positions, normals);
+	}
+
+
+	// =======================================================
+	// s
+	// =======================================================
+	SkinningEvaluator::SkinningEvaluator(unsigned int threadNum)
+		: pool(threadNum)
+	{
+	}
+
+	SkinningEvaluator::~SkinningEvaluator()
+	{
+	}
+
+	unsigned int SkinningEvaluator::GetThreadNum() const
+	{
+		return pool.GetThreadNum();
+	}
+
+	void SkinningEvaluator::SkinVertices(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+		const M3x4* palette, F3* positions, F3* normals)
+	{
+		pool.Run(vertexNum, SKINNING_CHUNK, [&](size_t begin, size_t end) {
+			SkinVertexRange(vertices, boneWeights, (unsigned int)begin, (unsigned int)end, palette, positions, normals);
+		});
+	}
+
+	void SkinningEvaluator::SkinMesh(const MESH* mesh, const M3x4* palette, F3* positions, F3* normals)
+	{
+		if (mesh->boneNum == 0) {
+			return;
+		}
+		SkinVertices(mesh->vertices, mesh->boneWeights, mesh->vertexNum, palette, positions, normals);
+	}
+
+} // namespace MG
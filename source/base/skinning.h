@@ -0,0 +1,88 @@
+// =======================================================
+// skinning.h
+//
+// XLjOp̃{[s
+// bṼ{[ƂɃItZbgsƍ̎p̃[hs|āA
+// VF[_[ɂ̂܂ܓnpbgɂ
+// i_Ƃ̊|ZɌ炷߁ACPUňxvZj
+//
+// CPUXLjO
+// RWAoEfBOAxCNȂGPUʂɕό`̒_~Ƃp
+// shader.hlslBoneVertexShaderPolygonƓvZi4eA@͐Kj
+// ߃ZbganimationKernelƓIiSetAnimationKerneljɏ]
+//
+// fANH[^jIXLjO
+// {[1{8vfi]{sړjŎA˂ŒׂȂiLfBbp[j
+// gk͕\Ȃ̂ŁApbgspaceiʂ̓[gm[h̃[hsj̋t|ĊOčA
+// _ioCh|[ỸfԁjĂŌspace|
+// [g̈lȊgkspaceɓ̂ŎcA{[Kw̒̊gk͎̂Ă
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _SKINNING_H
+#define _SKINNING_H
+
+#include "pose.h"
+#include "crowd.h"
+
+namespace MG {
+
+	// VF[_[BoneBufferɓ{[s̐
+	static constexpr unsigned int SKIN_PALETTE_MAX = 100;
+
+	enum SKINNING_MODE {
+		SKINNING_MODE_LINEAR,			// s̐`uh
+		SKINNING_MODE_DUAL_QUATERNION	// fANH[^jI
+	};
+
+	// PʃfANH[^jI
+	struct DUAL_QUATERNION {
+		Quaternion real;	// ]
+		Quaternion dual;	// 0.5 * sړ * real
+	};
+
+	// palette[b] = bones[b].offset * {[̃m[h̃[hs
+	// paletteboneNummۂĂ
+	void BuildSkinPalette(const Model* model, const Pose& pose, const MESH_BONE* bones, unsigned int boneNum, M3x4* palette);
+
+	// vertexNum̒_XLjOďo
+	// normalsnullptrȂvZȂ
+	void SkinVertices(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+		const M3x4* palette, F3* positions, F3* normals);
+	void SkinMesh(const MESH* mesh, const M3x4* palette, F3* positions, F3* normals);
+
+	// ]ƕsړoi񂲂ƂɐKĊgk̂Ăj
+	DUAL_QUATERNION DualQuaternionFromMatrix(const M3x4& matrix);
+
+	// palette[b] = bones[b].offset * {[̃[hs * space.Inverse() ̉]ƕsړ
+	void BuildDualQuaternionPalette(const Model* model, const Pose& pose, const MESH_BONE* bones, unsigned int boneNum,
+		const M3x4& space, DUAL_QUATERNION* palette);
+
+	// QƗp̃XJ[iVF[_[DualQuaternionBoneVertexShaderPolygonƓvZj
+	// _ĂAspace|ďo
+	void SkinVerticesDualQuaternion(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+		const DUAL_QUATERNION* palette, const M3x4& space, F3* positions, F3* normals);
+
+	// =======================================================
+	// CPUXLjO̕s
+	//
+	// _SKINNING_CHUNKɕChunkedJobPoolicrowd.hjŎ荇
+	// =======================================================
+	class SkinningEvaluator {
+	private:
+		ChunkedJobPool pool;
+	public:
+		SkinningEvaluator(unsigned int threadNum = std::thread::hardware_concurrency());
+		~SkinningEvaluator();
+		SkinningEvaluator(const SkinningEvaluator&) = delete;
+		SkinningEvaluator& operator=(const SkinningEvaluator&) = delete;
+
+		unsigned int GetThreadNum() const;
+		void SkinVertices(const VERTEX* vertices, const VERTEX_BONE_WEIGHT* boneWeights, unsigned int vertexNum,
+			const M3x4* palette, F3* positions, F3* normals);
+		void SkinMesh(const MESH* mesh, const M3x4* palette, F3* positions, F3* normals);
+	};
+
+} // namespace MG
+
+#endif
@@ -25,10 +25,19 @@ cbuffer LightBuffer : register(b2)
     float4 driectLightLocal;
 }
 
+// ItZbgs~[hsiCPUŌvZς݁j
+// AtBϊȂ̂3si1s1WX^ɋl߂邽row_majorj
 cbuffer BoneBuffer : register(b3)
 {
-    float4x4 boneOffsetMatrix[100];
-    float4x4 boneWorldMatrix[100];
+    row_major float3x4 bonePalette[100];
+};
+
+// fANH[^jIŁi1{ɂ][2i]ƃfA[2i+1]j
+// gkspace̋t|ĊOĂiskinning.hQƁj
+cbuffer DualQuaternionBoneBuffer : register(b4)
+{
+    row_major float3x4 dualQuaternionSpace;
+    float4 boneDualQuaternion[200];
 };
 
 //*****************************************************************************
@@ -80,8 +89,8 @@ void BoneVertexShaderPolygon(
     
     for (int i = 0; i < 4; ++i)
     {
-        skinnedPosition += inBoneWeights[i] * mul(boneWorldMatrix[inBoneIndexes[i]], mul(boneOffsetMatrix[inBoneIndexes[i]], inPosition));
-        skinnedNormal += inBoneWeights[i] * mul((float3x3) boneWorldMatrix[inBoneIndexes[i]], mul((float3x3) boneOffsetMatrix[inBoneIndexes[i]], normal));
+        skinnedPosition += inBoneWeights[i] * float4(mul(bonePalette[inBoneIndexes[i]], inPosition), 1.0f);
+        skinnedNormal += inBoneWeights[i] * mul((float3x3) bonePalette[inBoneIndexes[i]], normal);
         //float3x3 rotationMatrix = (float3x3) boneMatrix[inBoneIndexes[i]];
         
         //skinnedNormal += inBoneWeights[i] * mul(rotationMatrix, normal);
@@ -131,6 +140,52 @@ void BoneVertexShaderPolygon(
     
 }
 
+// skinning.cppSkinVerticesDualQuaternionƓvZ
+void DualQuaternionBoneVertexShaderPolygon(
+    in float4 inPosition : POSITION0,
+    in float4 inNormal : NORMAL0,
+    in float4 inDiffuse : COLOR0,
+    in float2 inTexCoord : TEXCOORD0,
+    in uint4 inBoneIndexes : BLENDINDICES0,
+    in float4 inBoneWeights : BLENDWEIGHT0,
+
+    out float4 outPosition : SV_POSITION,
+    out float4 outNormal : NORMAL0,
+    out float2 outTexCoord : TEXCOORD0,
+    out float4 outDiffuse : COLOR0)
+{
+    // ŏ̃{[Ƌt͕̂̂𔽓]č
+    float4 pivot = boneDualQuaternion[inBoneIndexes[0] * 2];
+    float4 real = float4(0.0f, 0.0f, 0.0f, 0.0f);
+    float4 dual = float4(0.0f, 0.0f, 0.0f, 0.0f);
+    for (int i = 0; i < 4; ++i)
+    {
+        float4 boneReal = boneDualQuaternion[inBoneIndexes[i] * 2];
+        float4 boneDual = boneDualQuaternion[inBoneIndexes[i] * 2 + 1];
+        float weight = dot(boneReal, pivot) < 0.0f ? -inBoneWeights[i] : inBoneWeights[i];
+        real += weight * boneReal;
+        dual += weight * boneDual;
+    }
+    float inverseLength = rsqrt(dot(real, real));
+    real *= inverseLength;
+    dual *= inverseLength;
+
+    float3 position = inPosition.xyz;
+    float3 normal = inNormal.xyz;
+    position += 2.0f * cross(real.xyz, cross(real.xyz, position) + real.w * position);
+    position += 2.0f * (real.w * dual.xyz - dual.w * real.xyz + cross(real.xyz, dual.xyz));
+    normal += 2.0f * cross(real.xyz, cross(real.xyz, normal) + real.w * normal);
+
+    float4 skinnedPosition = float4(mul(dualQuaternionSpace, float4(position, 1.0f)), 1.0f);
+    float3 skinnedNormal = mul((float3x3) dualQuaternionSpace, normal);
+
+    outPosition = mul(skinnedPosition, worldViewProjection);
+    outNormal = float4(normalize(skinnedNormal).xyz, 0);
+    outTexCoord = inTexCoord * uvRange + uvOffset;
+
+    outDiffuse = inDiffuse * color;
+}
+
 //=============================================================================
 // sNZVF[_
 //=============================================================================
@@ -2,14 +2,14 @@
 #include "progress.h"
 #include "input.h"
 #include "config.h"
-#include <functional>
+#include "animationStateMachine.h"
+#include <windows.h>
 using namespace MG;
 
 namespace TestScene {
 	static constexpr const char* MODEL = "asset\\model\\kumacchi.mgm";
-	static constexpr const char* WALK_ANIMATION = "asset\\model\\kumacchi_walk.mga";
 	static constexpr const char* BLINK_ANIMATION = "asset\\model\\kumacchi_blink.mga";
-	static constexpr const char* SWING_DOWN_ANIMATION = "asset\\model\\kumacchi_swing_down.mga";
+	static constexpr const char* STATE_MACHINE = "asset\\model\\kumacchi_state.csv";
 	static constexpr const char* TRAIL_TEXTURE = "asset\\texture\\trail.png";
 	static constexpr const char* PAD_MODEL = "asset\\model\\pad.mgm";
 
@@ -24,18 +24,14 @@ namespace TestScene {
 		};
 	private:
 		Model* model;
-		Animation* walkAnimation;
 		Animation* blinkAnimation;
-		Animation* swingDownAnimation;
-		Progress walkTime{ 1000.0f, true };
+		AnimationCursor blinkCursor;
+		const AnimationBinding* blinkBinding;
 		Progress blinkTime{ 1000.0f, true };
-		Progress swingTime{ 700.0f, false };
-		Progress animationTransitionTime{ 300.0f, false };
 		Progress padProgress{ 4000.0f, true }; // ~̉]W
 		Progress HSVT{ 1400.0f, true }; // OGtFNg̕ϐFW
 		 
-		F3 kumaFront{ 0.0f, 0.0f, 1.0f };
-		F3 kumaSize{ 0.1f, 0.1f, 0.1f };
+		GameObject kuma{ F3{ 0.1f, 0.1f, 0.1f } }; // ʒuAAx̓[g[VŐi
 
 		Model* padModel;
 		F3 padPosition;
@@ -47,10 +43,14 @@ namespace TestScene {
 		std::vector<VERTEX> verticesPadTrail;
 		std::vector<VERTEX> verticesOnHand;
 
-		std::function<void()> updateFunc;
-		std::function<void()> animTransFunc;
-		std::map<MODEL_NODE*, M4x4> modelTransforms;
-		std::map<MODEL_NODE*, M4x4> onHandTransforms;
+		AnimationStateMachine stateMachine;
+		unsigned int moveCondition;
+		unsigned int swingCondition;
+		unsigned int walkState;
+		std::vector<ANIMATION_APPLICANT> blinkLayers;
+		Pose modelPose;
+		Pose onHandPose;
+		BoneMask faceMask; // ܂΂C[̃}XNi炾j
 	public:
 		void Init() override;
 		//void Uninit() override;
@@ -58,9 +58,7 @@ namespace TestScene {
 		void Draw() override;
 		//LAYER_TYPE GetLayerType(int layer) override;
 
-		void UpdateIdle();
-		void UpdateWalk();
-		void UpdateSwing();
+		void UpdateAnimation();
 
 		M4x4 GetWorldMartix();
 		
@@ -76,6 +74,9 @@ namespace TestScene {
 		};
 	});
 
+	// Aj[V̏ԂƑJ
+	static const ANIMATION_STATE_MACHINE_CONFIG STATE_MACHINE_CONFIG = LoadConfig<ANIMATION_STATE_MACHINE_CONFIG>(STATE_MACHINE, LoadAnimationStateMachineConfig);
+
 
 	// =======================================================
 	// V[o^
@@ -91,22 +92,30 @@ namespace TestScene {
 
 		// \[Xǂݍ
 		model = LoadModel(MODEL);
-		walkAnimation = LoadAnimation(WALK_ANIMATION);
 		blinkAnimation = LoadAnimation(BLINK_ANIMATION);
-		swingDownAnimation = LoadAnimation(SWING_DOWN_ANIMATION);
 		padModel = LoadModel(PAD_MODEL);
 
+		// fƃAj[V̑Ή\
+		blinkBinding = GetAnimationBinding(model, blinkAnimation);
+
+		// Xe[g}Vit[̊mۂȂ߁Aobt@Ŋmہj
+		if (!stateMachine.Init(model, STATE_MACHINE_CONFIG)) {
+			MessageBox(NULL, stateMachine.GetError().c_str(), STATE_MACHINE, MB_OK | MB_ICONERROR);
+		}
+		moveCondition = stateMachine.GetConditionIndex("MOVE");
+		swingCondition = stateMachine.GetConditionIndex("SWING");
+		walkState = stateMachine.GetStateIndex("walk");
+		modelPose.Resize(model->nodeNum);
+		blinkLayers.reserve(1);
+
+		// ܂΂̓`l̃m[hɏd˂
+		faceMask.SetBinding(blinkBinding);
+
 		// J΂߂ɐݒu
 		currentCamera->SetPosition({ 0.3f, 0.0f, -1.0f });
 		currentCamera->SetFront(Normalize(F3{} - currentCamera->GetPosition()));
 
 		trailTexture = LoadTexture(TRAIL_TEXTURE);
-
-		updateFunc = [this]() { UpdateIdle(); };
-
-		animTransFunc = [this]() {
-			LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms);
-		};
 	}
 
 
@@ -124,19 +133,14 @@ namespace TestScene {
 	// =======================================================
 	void TestScene::Update()
 	{
-		if (updateFunc) {
-			updateFunc();
-		}
-		if (animTransFunc) {
-			animTransFunc();
-		}
+		UpdateAnimation();
 		
 
 		// fACe|WVT
 		MODEL_NODE* padNode = FindNodeByName(model->rawModel->rootNode, "padPos");
 		if (padNode) {
-			M4x4 world = modelTransforms.at(padNode); // ĂACeWorld
-			LoadNodeWorldTransforms(padModel->rawModel->rootNode, world, onHandTransforms);
+			M4x4 world = modelPose.GetWorld(model->GetNodeIndex(padNode)).ToM4x4(); // ĂACeWorld
+			LoadNodeWorldTransforms(padModel, world, onHandPose);
 		}
 		
 
@@ -149,7 +153,7 @@ namespace TestScene {
 				verticesOnHand.erase(verticesOnHand.begin());
 			}
 
-			M4x4& transform = onHandTransforms.at(FindNodeByName(padModel->rawModel->rootNode, "pCube1"));
+			const M3x4& transform = onHandPose.GetWorld(padModel->GetNodeIndex(FindNodeByName(padModel->rawModel->rootNode, "pCube1")));
 			verticesOnHand.push_back({ transform * F3{  0.0f, 0.0f,   0.5f }, Normalize(transform * F3{ 0.0f , 1.0f, 0.0f }), color, { 0.0f, 0.0f } });
 			verticesOnHand.push_back({ transform * F3{  0.0f, 0.0f,  -0.5f }, Normalize(transform * F3{ 0.0f , 1.0f, 0.0f }), color, { 0.0f, 1.0f } });
 
@@ -181,7 +185,7 @@ namespace TestScene {
 			F3 p0 = F3{ 0.0f, 0.0f, 0.5f } *padModel->rawModel->rootNode->children->scale.z * 0.1f;
 			F3 p1 = F3{ 0.0f, 0.0f, -0.5f } *padModel->rawModel->rootNode->children->scale.z * 0.1f;
 
-			M4x4 transform = M4x4::ScalingMatrix({ 1.0f, 1.0f, 1.0f }) * M4x4::RotatingMatrix(Quaternion::AxisYDegree(padRotate)) * M4x4::TranslatingMatrix(padPosition);
+			M4x4 transform = M4x4::FromTRS({ 1.0f, 1.0f, 1.0f }, Quaternion::AxisYDegree(padRotate), padPosition);
 
 			verticesPadTrail.push_back({
 				transform * p0,
@@ -207,229 +211,75 @@ namespace TestScene {
 		HSVT.IncreaseValue(GetDeltaTime());
 	}
 
-	void TestScene::UpdateIdle()
-	{
-		if (
-			IsInputDown(INPUT_RIGHT) || 
-			IsInputDown(INPUT_LEFT) ||
-			IsInputDown(INPUT_UP) || 
-			IsInputDown(INPUT_DOWN)
-		) {
-			// IdleԂ̕
-
-			walkTime = 0.0f; // Aj[Vt0ɂ
-			updateFunc = [this]() mutable { UpdateWalk(); };
-
-			// Aj[VXV֐ύX
-			animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-				LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-					// Jڌ̃Aj[V
-					{ { blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime } }, 
-
-					// Jڐ̃Aj[V
-					{
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime }, // ܂΂͂̂܂
-						{ walkAnimation, walkAnimation->rawAnimation->frames * walkTime }
-					},
-
-					t // `ԌW
-				);
-
-				// ԌWXV
-				t.IncreaseValue(GetDeltaTime());
-			};
-		}
-		else if (IsInputTrigger(INPUT_OK)) {
-			// IdleԂ̐U艺낵
-
-			swingTime = 0.0f; // U艺낵Aj[Vt0ɂ
-			updateFunc = [this]() mutable { UpdateSwing(); };
-
-			// Aj[VXV֐ύX
-			animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-				LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-					// Jڌ̃Aj[V
-					{ { blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime } },
-
-					// Jڐ̃Aj[V
-					{
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime }, // ܂΂͂̂܂
-						{ swingDownAnimation, swingDownAnimation->rawAnimation->frames * swingTime }
-					},
-					
-					t // `ԌW
-				);
-
-				// ԌWXV
-				t.IncreaseValue(GetDeltaTime());
-			};
-		}
-
-		// ܂΂Aj[V̎ԍXV
-		blinkTime.IncreaseValue(GetDeltaTime());
-	}
-
-	void TestScene::UpdateWalk()
+	// =======================================================
+	// Aj[V̍XV
+	// ͂JڏɂăXe[g}Vi߁A
+	// ̂̎p]ĂA܂΂炾ɏd˂
+	// =======================================================
+	void TestScene::UpdateAnimation()
 	{
-		bool walk = false;
+		bool move = false;
 		F3 direct{ 0.0f, 0.0f, 0.0f };
 		if (IsInputDown(INPUT_RIGHT)) {
 			direct = { 1.0f, 0.0f, 0.0f };
-			walk = true;
+			move = true;
 		}
 		else if (IsInputDown(INPUT_LEFT)) {
 			direct = { -1.0f, 0.0f, 0.0f };
-			walk = true;
+			move = true;
 		}
 		else if (IsInputDown(INPUT_UP)) {
 			direct = { 0.0f, 0.0f, 1.0f };
-			walk = true;
+			move = true;
 		}
 		else if (IsInputDown(INPUT_DOWN)) {
 			direct = { 0.0f, 0.0f, -1.0f };
-			walk = true;
+			move = true;
 		}
 
-		if (walk) {
+		if (move && stateMachine.GetCurrentState() == walkState) {
 			float maxAngle = CONFIG.ROTATE_SPEED * GetDeltaTime() * 0.001f;
+			F3 kumaFront = Rotate(F3{ 0.0f, 0.0f, 1.0f }, kuma.rotate);
 
 			if (acosf(Dot(kumaFront, direct)) > maxAngle) {
 				// pxő]x傫̏ꍇ
 				if (Dot(kumaFront, Rotate(direct, Quaternion::AxisYDegree(90.0f))) < 0.0f) {
 					// v
-					kumaFront = Rotate(kumaFront, Quaternion::AxisYRadian(maxAngle));
+					kuma.rotate = kuma.rotate * Quaternion::AxisYRadian(maxAngle);
 				}
 				else {
 					// tv
-					kumaFront = Rotate(kumaFront, Quaternion::AxisYRadian(-maxAngle));
+					kuma.rotate = kuma.rotate * Quaternion::AxisYRadian(-maxAngle);
 				}
 			}
 			else {
 				// pxő]x菬̏ꍇ
-				kumaFront = direct;
+				kuma.rotate = Quaternion(direct);
 			}
 		}
 
-		if (IsInputTrigger(INPUT_OK)) {
-			// ԂU艺낵Ԃ
-
-			swingTime = 0.0f;
-			updateFunc = [this]() mutable { UpdateSwing(); };
-
-			// Aj[VXV֐ύX
-			animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-				LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-					// Jڌ̃Aj[V
-					{ 
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime },
-						{ walkAnimation, walkAnimation->rawAnimation->frames * walkTime }
-					},
-
-					// Jڐ̃Aj[V
-					{
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime }, // ܂΂͂̂܂
-						{ swingDownAnimation, swingDownAnimation->rawAnimation->frames * swingTime }
-					}, 
-
-					t // `ԌW
-				);
-
-				// ԌWXV
-				t.IncreaseValue(GetDeltaTime());
-			};
-		}
-		else if (!walk) {
-			// Ԃ~Ԃ
-
-			updateFunc = [this]() mutable { UpdateIdle(); };
-			
-			// Aj[VXV֐ύX
-			animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-				LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-					// Jڌ̃Aj[V
-					{
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime },
-						{ walkAnimation, walkAnimation->rawAnimation->frames * walkTime }
-					},
-
-					// Jڐ̃Aj[V
-					{
-						{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime } // ܂΂͂̂܂
-					}, 
-
-					t // `ԌW
-				);
-
-				// ԌWXV
-				t.IncreaseValue(GetDeltaTime());
-			};
-		}
+		// Jڏݒ肵ďԂXV
+		stateMachine.SetCondition(moveCondition, move);
+		stateMachine.SetCondition(swingCondition, IsInputTrigger(INPUT_OK));
+		stateMachine.Update((float)GetDeltaTime());
 
-		// Aj[V̎ԍXV
-		walkTime.IncreaseValue(GetDeltaTime());
+		// [g[VifԂ̈ړ̌ŉ񂵂đxɂA[ɑj
+		const ROOT_MOTION_DELTA& rootMotion = stateMachine.GetRootMotion();
+		float deltaTime = (float)GetDeltaTime();
+		kuma.velocity = (deltaTime > 0.0f) ? Rotate(rootMotion.position * kuma.size, kuma.rotate) * (1.0f / deltaTime) : F3{};
+		kuma.position += kuma.velocity * deltaTime;
+		kuma.rotate = kuma.rotate * Quaternion::AxisYRadian(rootMotion.yaw);
+		kuma.rotate.Normalize();
 
-		// ܂΂Aj[V̎ԍXV
-		blinkTime.IncreaseValue(GetDeltaTime());
-	}
+		// ݂̏Ԃ]iJڒ͊ԁj
+		stateMachine.Evaluate(modelPose, (float)GetDeltaTime());
 
-	void TestScene::UpdateSwing()
-	{
-		if (swingTime == 1.0f) {
-			// U艺낵Aj[VI
-
-			if (
-				IsInputDown(INPUT_RIGHT) ||
-				IsInputDown(INPUT_LEFT) ||
-				IsInputDown(INPUT_UP) ||
-				IsInputDown(INPUT_DOWN)
-			)
-			{
-				// Ԃ
-
-				walkTime = 0.0f;
-				updateFunc = [this]() mutable { UpdateWalk(); };
-				animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-					LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-						// Jڌ̃Aj[V
-						{
-							{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime },
-							{ swingDownAnimation, swingDownAnimation->rawAnimation->frames * swingTime }
-						},
-
-						// Jڐ̃Aj[V
-						{
-							{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime },
-							{ walkAnimation, walkAnimation->rawAnimation->frames * walkTime }
-						}, t
-					);
-					t.IncreaseValue(GetDeltaTime());
-				};
-			}
-			else {
-				// ~Ԃ
-
-				updateFunc = [this]() mutable { UpdateIdle(); };
-				animTransFunc = [this, t = Progress{ 300.0f, false }]() mutable {
-					LoadNodeWorldTransforms(model->rawModel->rootNode, GetWorldMartix(), modelTransforms,
-						// Jڌ̃Aj[V
-						{
-							{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime },
-							{ swingDownAnimation, swingDownAnimation->rawAnimation->frames * swingTime }
-						},
-
-						// Jڐ̃Aj[V
-						{
-							{ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime }
-						}, t
-					);
-					t.IncreaseValue(GetDeltaTime());
-				};
-			}
-			
-		}
+		// ܂΂͊炾̃C[
+		blinkLayers.clear();
+		blinkLayers.push_back({ blinkAnimation, blinkAnimation->rawAnimation->frames * blinkTime, &blinkCursor, blinkBinding, 1.0f, &faceMask });
+		ApplyNodeLayers(model, modelPose, blinkLayers);
 
-		// U艺낵Aj[V̎ԍXV
-		swingTime.IncreaseValue(GetDeltaTime());
+		UpdateNodeWorldTransforms(model, GetWorldMartix(), modelPose);
 
 		// ܂΂Aj[V̎ԍXV
 		blinkTime.IncreaseValue(GetDeltaTime());
@@ -444,9 +294,9 @@ namespace TestScene {
 		
 		GetRenderer()->ApplyCamera(currentCamera);
 		
-		DrawModel(model, modelTransforms);
+		DrawModel(model, modelPose);
 
-		DrawModel(padModel, onHandTransforms);
+		DrawModel(padModel, onHandPose);
 
 		DrawModel(padModel, padPosition, { 0.1f, 0.1f, 0.1f }, Quaternion::AxisYDegree(padRotate));
 
@@ -471,6 +321,6 @@ namespace TestScene {
 	}*/
 
 	M4x4 TestScene::GetWorldMartix() {
-		return M4x4::ScalingMatrix(kumaSize) * M4x4::RotatingMatrix(Quaternion::Quaternion(kumaFront));
+		return M4x4::ScalingMatrix(kuma.size) * M4x4::RotatingMatrix(kuma.rotate) * M4x4::TranslatingMatrix(kuma.position);
 	}
 }
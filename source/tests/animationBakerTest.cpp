@@ -0,0 +1,67 @@
+// =======================================================
+// animationBakerTest.cpp
+//
+// GetBakedSamples̃eXg
+// [v̎Nbv̒ɂȂ邱ƁA
+// Ō̍sŏ̍sւ̓Nbv̏I܂ł̒[̊ԂԂ邱
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "animationBaker.h"
+
+using namespace MG;
+
+static void CheckSamples(const BAKED_ANIMATION* baked, unsigned int clip, float time, bool loop,
+	unsigned int expectedSample0, unsigned int expectedSample1, float expectedT)
+{
+	unsigned int sample0, sample1;
+	float t;
+	GetBakedSamples(baked, clip, time, loop, sample0, sample1, t);
+	TEST_CHECK(sample0 == expectedSample0);
+	TEST_CHECK(sample1 == expectedSample1);
+	TEST_CHECK_NEAR(t, expectedT, 1e-3);
+	if (sample0 != expectedSample0 || sample1 != expectedSample1) {
+		printf("  clip %u time %g loop %d: %u -> %u (%g)\n", clip, time, (int)loop, sample0, sample1, t);
+	}
+}
+
+int main()
+{
+	// s̒g͎gȂ̂ŁAwb_[ƃNbv
+	BAKED_CLIP clips[2] = {};
+	// 30t[A30fpsA30HzF0b1b܂31s
+	clips[0].firstRow = 0;
+	clips[0].rowNum = 31;
+	clips[0].frames = 30.0f;
+	clips[0].frameRate = 30.0f;
+	// 10t[A30fpsA20HzFŌ̍s0.3bANbv̏I1/3b
+	clips[1].firstRow = 31;
+	clips[1].rowNum = 7;
+	clips[1].frames = 10.0f;
+	clips[1].frameRate = 30.0f;
+
+	BAKED_ANIMATION baked = {};
+	baked.mode = BAKE_MODE_NODE_MATRIX;
+	baked.sampleRate = 30.0f;
+	baked.clipNum = 2;
+	baked.clips = clips;
+
+	// 1bi31Tvł͂Ȃj
+	CheckSamples(&baked, 0, 0.5f, true, 15, 16, 0.0f);
+	CheckSamples(&baked, 0, 1.0f, true, 0, 1, 0.0f);
+	CheckSamples(&baked, 0, 1.5f, true, 15, 16, 0.0f);
+	CheckSamples(&baked, 0, 10.25f, true, 7, 8, 0.5f);
+	CheckSamples(&baked, 0, 0.99f, true, 29, 30, 0.7f);
+	// [vȂ΍Ō̍sŎ~܂
+	CheckSamples(&baked, 0, 1.5f, false, 30, 30, 0.0f);
+
+	baked.sampleRate = 20.0f;
+	CheckSamples(&baked, 1, 0.025f, true, 0, 1, 0.5f);
+	// 0.3b1/3b̊ԂōŌ̍sŏ̍s
+	CheckSamples(&baked, 1, 0.3f + 1.0f / 60.0f, true, 6, 0, 0.5f);
+	CheckSamples(&baked, 1, 1.0f / 3.0f + 0.025f, true, 0, 1, 0.5f);
+	CheckSamples(&baked, 1, 0.3f + 1.0f / 60.0f, false, 6, 6, 0.0f);
+
+	return TEST_RESULT();
+}
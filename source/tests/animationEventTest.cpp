@@ -0,0 +1,234 @@
+// =======================================================
+// animationEventTest.cpp
+//
+// Aj[ṼCxggbÑeXg
+// EQuery͈̔͂SCxgɒׂʂƁAԂ܂Ŋ܂߂Ĉv邱
+//   iCxg0A1A5000A[vEȂAȏAI[傤ǁAI[܂j
+// ELoad̓t[lƂēǂ߂Ȃs΂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "animationEvent.h"
+#include <random>
+#include <vector>
+
+using namespace MG;
+
+// SCxgɒׂāAʉ߂Cxg̔ԍĐɕׂ
+static std::vector<unsigned int> BruteForce(const AnimationEventTrack& track, float frame0, float frame1, float frames, bool loop)
+{
+	std::vector<unsigned int> result;
+	const unsigned int eventNum = track.GetEventNum();
+
+	if (!loop || frames <= 0.0f) {
+		frame0 = std::max(frame0, 0.0f);
+		frame1 = std::min(frame1, frames);
+		if (frame1 <= frame0) {
+			return result;
+		}
+		for (unsigned int i = 0; i < eventNum; i++) {
+			float frame = track.GetEvent(i).frame;
+			if (frame >= frame0 && (frame < frame1 || frame1 >= frames)) {
+				result.push_back(i);
+			}
+		}
+		return result;
+	}
+
+	if (frame1 < frame0) {
+		frame1 += frames;
+	}
+	if (frame1 - frame0 >= frames) {
+		for (unsigned int i = 0; i < eventNum; i++) {
+			result.push_back(i);
+		}
+		return result;
+	}
+	float start = fmodf(frame0, frames);
+	if (start < 0.0f) {
+		start += frames;
+	}
+	float end = start + (frame1 - frame0);
+
+	// I[܂ŁiI[ɓ͂I[̂̂j
+	for (unsigned int i = 0; i < eventNum; i++) {
+		float frame = track.GetEvent(i).frame;
+		if (frame >= start && (frame < end || (end >= frames && frame <= frames))) {
+			result.push_back(i);
+		}
+	}
+	// 擪ɖ߂
+	if (end >= frames) {
+		for (unsigned int i = 0; i < eventNum; i++) {
+			float frame = track.GetEvent(i).frame;
+			if (frame < end - frames && frame < start) {
+				result.push_back(i);
+			}
+		}
+	}
+	return result;
+}
+
+static bool CheckQuery(const AnimationEventTrack& track, float frame0, float frame1, float frames, bool loop)
+{
+	ANIMATION_EVENT_RANGE ranges[ANIMATION_EVENT_RANGE_MAX];
+	unsigned int rangeNum = track.Query(frame0, frame1, frames, loop, ranges);
+	if (rangeNum > ANIMATION_EVENT_RANGE_MAX) {
+		return false;
+	}
+	std::vector<unsigned int> queried;
+	for (unsigned int r = 0; r < rangeNum; r++) {
+		if (ranges[r].num == 0 || ranges[r].first + ranges[r].num > track.GetEventNum()) {
+			return false;
+		}
+		for (unsigned int i = 0; i < ranges[r].num; i++) {
+			queried.push_back(ranges[r].first + i);
+		}
+	}
+	if (queried != BruteForce(track, frame0, frame1, frames, loop)) {
+		printf("Query(%g, %g, %g, %s) mismatch\n", frame0, frame1, frames, loop ? "loop" : "once");
+		return false;
+	}
+	return true;
+}
+
+// ܂EƁACxgE_Ȉʒȗgݍ킹
+static void CheckTrack(const AnimationEventTrack& track, float frames, unsigned int randomNum)
+{
+	for (int loop = 0; loop < 2; loop++) {
+		bool isLoop = loop != 0;
+
+		// ~܂ĂAŚAȏ
+		TEST_CHECK(CheckQuery(track, 10.0f, 10.0f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, 0.0f, frames, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, 3.0f, 3.0f + frames, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, 3.0f, 3.0f + frames * 2.5f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, -frames * 0.5f, frames * 0.75f, frames, isLoop));
+
+		// I[傤ǁAI[̎OAI[܂
+		TEST_CHECK(CheckQuery(track, frames - 5.0f, frames, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, frames - 5.0f, frames - 0.5f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, frames - 5.0f, frames + 5.0f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, frames - 5.0f, 5.0f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, frames, frames + 1.0f, frames, isLoop));
+		TEST_CHECK(CheckQuery(track, frames * 3.0f - 2.0f, frames * 3.0f, frames, isLoop));
+	}
+
+	std::mt19937 random(23);
+	std::uniform_real_distribution<float> frameRange(-frames, frames * 2.0f);
+	std::uniform_real_distribution<float> stepRange(0.0f, frames * 1.25f);
+	std::uniform_int_distribution<unsigned int> kindRange(0, 3);
+	unsigned int eventNum = track.GetEventNum();
+	unsigned int failureNum = 0;
+	for (unsigned int n = 0; n < randomNum; n++) {
+		float frame0 = frameRange(random);
+		// Cxĝ傤Ǐォn߂AI
+		if (eventNum > 0 && kindRange(random) == 0) {
+			frame0 = track.GetEvent(random() % eventNum).frame;
+		}
+		float frame1 = frame0 + stepRange(random);
+		unsigned int kind = kindRange(random);
+		if (eventNum > 0 && kind == 0) {
+			frame1 = track.GetEvent(random() % eventNum).frame;
+		}
+		else if (kind == 1) {
+			frame1 = frameRange(random);
+		}
+		bool loop = (random() & 1) != 0;
+		if (!CheckQuery(track, frame0, frame1, frames, loop)) {
+			failureNum++;
+		}
+	}
+	TEST_CHECK(failureNum == 0);
+}
+
+static void CheckEmpty()
+{
+	AnimationEventTrack track;
+	TEST_CHECK(track.GetEventNum() == 0);
+	CheckTrack(track, 60.0f, 1000);
+}
+
+static void CheckOne()
+{
+	const float frames = 60.0f;
+	// 擪ArAI[̏
+	const float eventFrames[] = { 0.0f, 30.0f, frames };
+	for (float frame : eventFrames) {
+		AnimationEventTrack track;
+		track.SetEvents({ { frame, "one" } });
+		TEST_CHECK(track.GetEventNum() == 1);
+		CheckTrack(track, frames, 1000);
+	}
+}
+
+static void CheckMany()
+{
+	const float frames = 900.0f;
+	std::mt19937 random(5);
+	std::uniform_int_distribution<int> frameRange(0, (int)frames * 4);
+	std::vector<ANIMATION_EVENT> events;
+	events.reserve(5000);
+	// l̈t[݂ɂāAt[̃CxgƐ擪EI[̃Cxg
+	events.push_back({ 0.0f, "first" });
+	events.push_back({ frames, "last" });
+	while (events.size() < 5000) {
+		events.push_back({ frameRange(random) * 0.25f, "event" + std::to_string(events.size()) });
+	}
+	AnimationEventTrack track;
+	track.SetEvents(events);
+	TEST_CHECK(track.GetEventNum() == 5000);
+
+	// t[At[͓n
+	bool sorted = true;
+	for (unsigned int i = 1; i < track.GetEventNum(); i++) {
+		sorted = sorted && track.GetEvent(i - 1).frame <= track.GetEvent(i).frame;
+	}
+	TEST_CHECK(sorted);
+
+	CheckTrack(track, frames, 20000);
+	printf("5000 events: %u random queries\n", 20000);
+}
+
+static void CheckLoad()
+{
+	const char* path = "animationEventTest_event.csv";
+	FILE* file = fopen(path, "w");
+	TEST_CHECK(file != nullptr);
+	if (!file) {
+		return;
+	}
+	fprintf(file,
+		"frame,name\n"
+		"12,hit\n"
+		"abc,text\n"
+		"3.5,step\n"
+		"4x,trailing\n"
+		",empty\n"
+		"1e99,overflow\n"
+		"nan,nan\n"
+		"7 ,space\n");
+	fclose(file);
+
+	AnimationEventTrack track;
+	TEST_CHECK(track.Load(path));
+	remove(path);
+
+	TEST_CHECK(track.GetEventNum() == 3);
+	if (track.GetEventNum() == 3) {
+		TEST_CHECK(track.GetEvent(0).frame == 3.5f && track.GetEvent(0).name == "step");
+		TEST_CHECK(track.GetEvent(1).frame == 7.0f && track.GetEvent(1).name == "space");
+		TEST_CHECK(track.GetEvent(2).frame == 12.0f && track.GetEvent(2).name == "hit");
+	}
+	TEST_CHECK(!track.Load("animationEventTest_missing.csv"));
+}
+
+int main()
+{
+	CheckEmpty();
+	CheckOne();
+	CheckMany();
+	CheckLoad();
+	return TEST_RESULT();
+}
@@ -0,0 +1,211 @@
+// =======================================================
+// animationLodTest.cpp
+//
+// AnimationLod::PlañeXg
+// Eŏ̕]̓xɊ֌WȂSTvO邱ƁicoastupdateMaskȂj
+// EԊũCX^X͈ʑāAt[قړTvOA
+//   ǂ̃CX^XԊuƂɂ傤ǈTvO邱
+// EEt߂ŋhĂxsȂƁiƂj
+// EupdateMaskŊOꂽm[h͑Õ[Jϊ̂܂܁Ac͐VTvO邱
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "animationLod.h"
+#include <string.h>
+
+using namespace MG;
+
+static CROWD_JOB MakeJob(const Model* model, const std::vector<ANIMATION_APPLICANT>* applicants, float distance, Pose* pose)
+{
+	return { model, applicants, M4x4::TranslatingMatrix({ 0.0f, 0.0f, distance }), pose };
+}
+
+static void CheckFirstEvaluation(const Model* model, const std::vector<ANIMATION_APPLICANT>& applicants)
+{
+	AnimationLod lod;
+	lod.SetModelDepth(model, 1);
+	const size_t jobNum = 16;
+	std::vector<Pose> poses(jobNum);
+	std::vector<CROWD_JOB> jobs;
+	for (size_t i = 0; i < jobNum; i++) {
+		jobs.push_back(MakeJob(model, &applicants, 100.0f + i, &poses[i]));
+	}
+	std::vector<ANIMATION_LOD_STATE> states(jobNum);
+
+	// ŉ̃xi8t[{[ȗjłŏ͑S
+	lod.Plan(F3{}, jobs.data(), states.data(), jobNum);
+	for (size_t i = 0; i < jobNum; i++) {
+		TEST_CHECK(states[i].level == lod.GetLevels().size() - 1);
+		TEST_CHECK(!jobs[i].coast);
+		TEST_CHECK(jobs[i].updateMask == nullptr);
+		TEST_CHECK(states[i].evaluated);
+	}
+	TEST_CHECK(lod.GetCounters().sampledInstanceNum == jobNum);
+	TEST_CHECK(lod.GetCounters().skippedNodeNum == 0);
+
+	// rCX^Xŏ͑S
+	jobs.push_back(MakeJob(model, &applicants, 100.0f, &poses[0]));
+	states.push_back({});
+	lod.Plan(F3{}, jobs.data(), states.data(), jobs.size());
+	TEST_CHECK(!jobs.back().coast);
+	TEST_CHECK(jobs.back().updateMask == nullptr);
+}
+
+static void CheckPhaseStagger(const Model* model, const std::vector<ANIMATION_APPLICANT>& applicants)
+{
+	AnimationLod lod;
+	const unsigned int interval = 4;
+	lod.SetLevels({ { 0.0f, 1, false }, { 10.0f, interval, false } });
+	const size_t jobNum = 12;
+	std::vector<Pose> poses(jobNum);
+	std::vector<CROWD_JOB> jobs;
+	for (size_t i = 0; i < jobNum; i++) {
+		jobs.push_back(MakeJob(model, &applicants, 50.0f, &poses[i]));
+	}
+	std::vector<ANIMATION_LOD_STATE> states(jobNum);
+	lod.Plan(F3{}, jobs.data(), states.data(), jobNum);
+
+	std::vector<unsigned int> sampledCounts(jobNum, 0);
+	unsigned int minPerFrame = (unsigned int)jobNum, maxPerFrame = 0;
+	const unsigned int frameNum = interval * 5;
+	for (unsigned int f = 0; f < frameNum; f++) {
+		lod.Plan(F3{}, jobs.data(), states.data(), jobNum);
+		unsigned int sampled = 0;
+		for (size_t i = 0; i < jobNum; i++) {
+			if (!jobs[i].coast) {
+				sampledCounts[i]++;
+				sampled++;
+			}
+		}
+		TEST_CHECK(sampled == lod.GetCounters().sampledInstanceNum);
+		minPerFrame = std::min(minPerFrame, sampled);
+		maxPerFrame = std::max(maxPerFrame, sampled);
+	}
+	for (size_t i = 0; i < jobNum; i++) {
+		TEST_CHECK(sampledCounts[i] == frameNum / interval);
+	}
+	TEST_CHECK(minPerFrame == jobNum / interval);
+	TEST_CHECK(maxPerFrame == jobNum / interval);
+	printf("stagger: %zu instances every %u frames, %u-%u sampled per frame\n", jobNum, interval, minPerFrame, maxPerFrame);
+}
+
+// ̂̋distances̏ɓāAx̐؂ւ񐔂Ԃ
+static unsigned int CountLevelChanges(AnimationLod& lod, const Model* model, const std::vector<ANIMATION_APPLICANT>& applicants,
+	const std::vector<float>& distances, unsigned int& lastLevel)
+{
+	Pose pose;
+	ANIMATION_LOD_STATE state;
+	unsigned int changes = 0;
+	for (size_t i = 0; i < distances.size(); i++) {
+		CROWD_JOB job = MakeJob(model, &applicants, distances[i], &pose);
+		unsigned int previous = state.level;
+		lod.Plan(F3{}, &job, &state, 1);
+		if (i > 0 && state.level != previous) {
+			changes++;
+		}
+	}
+	lastLevel = state.level;
+	return changes;
+}
+
+static void CheckHysteresis(const Model* model, const std::vector<ANIMATION_APPLICANT>& applicants)
+{
+	AnimationLod lod;
+	lod.SetLevels({ { 0.0f, 1, false }, { 20.0f, 2, false } });
+	lod.SetHysteresis(0.1f);
+	unsigned int level = 0;
+
+	// ߂痈ċȆOŗhF鑤22܂Ő؂ւȂ
+	std::vector<float> jitter;
+	for (int i = 0; i < 40; i++) {
+		jitter.push_back((i % 2) ? 20.5f : 19.5f);
+	}
+	std::vector<float> distances = { 10.0f };
+	distances.insert(distances.end(), jitter.begin(), jitter.end());
+	TEST_CHECK(CountLevelChanges(lod, model, applicants, distances, level) == 0);
+	TEST_CHECK(level == 0);
+
+	// 痈ėhFx߂ÂĐ؂ւÂ܂
+	distances = { 30.0f };
+	distances.insert(distances.end(), jitter.begin(), jitter.end());
+	TEST_CHECK(CountLevelChanges(lod, model, applicants, distances, level) == 1);
+	TEST_CHECK(level == 0);
+
+	// zĉΐ؂ւ
+	distances = { 10.0f, 21.9f, 22.1f };
+	TEST_CHECK(CountLevelChanges(lod, model, applicants, distances, level) == 1);
+	TEST_CHECK(level == 1);
+}
+
+static void CheckMaskedNodes(const Model* model, Animation* animation, const AnimationBinding& binding)
+{
+	AnimationLod lod;
+	lod.SetLevels({ { 0.0f, 1, true } });
+	lod.SetModelDepth(model, 2);
+
+	AnimationCursor cursor;
+	std::vector<ANIMATION_APPLICANT> applicants{ { animation, 3.0f, &cursor, &binding } };
+	Pose pose;
+	CROWD_JOB job = MakeJob(model, &applicants, 5.0f, &pose);
+	ANIMATION_LOD_STATE state;
+	CrowdEvaluator evaluator(1);
+
+	// ڂ͑S
+	lod.Plan(F3{}, &job, &state, 1);
+	TEST_CHECK(job.updateMask == nullptr);
+	evaluator.Evaluate(&job, 1);
+	std::vector<NODE_TRANSFORM> previous(pose.GetLocals(), pose.GetLocals() + model->nodeNum);
+
+	// ڂ͐[m[hȂ
+	const float frame = animation->rawAnimation->frames * 0.5f;
+	applicants.clear();
+	applicants.push_back({ animation, frame, &cursor, &binding });
+	lod.Plan(F3{}, &job, &state, 1);
+	TEST_CHECK(job.updateMask != nullptr);
+	if (!job.updateMask) {
+		return;
+	}
+	evaluator.Evaluate(&job, 1);
+
+	AnimationCursor referenceCursor;
+	std::vector<ANIMATION_APPLICANT> reference{ { animation, frame, &referenceCursor, &binding } };
+	Pose expected;
+	LoadNodeLocalTransforms(model, expected, reference);
+
+	unsigned int keptNum = 0, changedNum = 0;
+	for (unsigned int n = 0; n < model->nodeNum; n++) {
+		const NODE_TRANSFORM& local = pose.GetLocals()[n];
+		if (job.updateMask->Test(n)) {
+			TEST_CHECK(memcmp(&local, &expected.GetLocals()[n], sizeof(NODE_TRANSFORM)) == 0);
+		}
+		else {
+			TEST_CHECK(memcmp(&local, &previous[n], sizeof(NODE_TRANSFORM)) == 0);
+			keptNum++;
+			if (memcmp(&previous[n], &expected.GetLocals()[n], sizeof(NODE_TRANSFORM)) != 0) {
+				changedNum++;
+			}
+		}
+	}
+	TEST_CHECK(keptNum > 0);
+	TEST_CHECK(changedNum > 0);	// Ȃm[hɁATvOĂΓ̂
+	TEST_CHECK(lod.GetCounters().skippedNodeNum == keptNum);
+	printf("masked: %u of %u nodes kept their previous locals (%u would have moved)\n", keptNum, model->nodeNum, changedNum);
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	std::vector<ANIMATION_APPLICANT> applicants{ { walk, 7.0f, nullptr, &binding } };
+
+	CheckFirstEvaluation(model, applicants);
+	CheckPhaseStagger(model, applicants);
+	CheckHysteresis(model, applicants);
+	CheckMaskedNodes(model, walk, binding);
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
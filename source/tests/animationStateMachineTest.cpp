@@ -0,0 +1,88 @@
+// =======================================================
+// animationStateMachineTest.cpp
+//
+// Xe[g}V̒``FbÑeXg
+// EEND܂߂32傤ǂȂǂݍ߁AŌ̃rbgłJڂ邱
+// E33ڂ̏AsȑJڐ̒`InitŒeAUpdateEvaluateȂ
+// EeƂł`ŏ邱
+// iAj[VȂ̏Ԃgj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "animationStateMachine.h"
+
+using namespace MG;
+
+// idle -> walk ̑JڂconditionNum̏ōiŌ̑Jڂwalkցj
+static ANIMATION_STATE_MACHINE_CONFIG MakeConfig(unsigned int conditionNum)
+{
+	ANIMATION_STATE_MACHINE_CONFIG config;
+	config.states.push_back({ "idle", "", true, 1000.0f, "" });
+	config.states.push_back({ "walk", "", true, 1000.0f, "" });
+	for (unsigned int i = 0; i < conditionNum; i++) {
+		std::string name = "C" + std::to_string(i);
+		bool last = i + 1 == conditionNum;
+		config.transitions.push_back({ "t" + std::to_string(i), "idle", last ? "walk" : "idle", name, 0.0f });
+	}
+	config.entry = "idle";
+	return config;
+}
+
+static void CheckConditionLimit(const Model* model)
+{
+	// ENDƍ킹32
+	unsigned int conditionNum = ANIMATION_CONDITION_MAX - 1;
+	AnimationStateMachine stateMachine;
+	TEST_CHECK(stateMachine.Init(model, MakeConfig(conditionNum)));
+	TEST_CHECK(stateMachine.GetError().empty());
+	std::string lastName = "C" + std::to_string(conditionNum - 1);
+	unsigned int lastCondition = stateMachine.GetConditionIndex(lastName.c_str());
+	TEST_CHECK(lastCondition == ANIMATION_CONDITION_MAX - 1);
+
+	stateMachine.SetCondition(lastCondition, true);
+	stateMachine.Update(16.0f);
+	TEST_CHECK(stateMachine.GetCurrentState() == stateMachine.GetStateIndex("walk"));
+	TEST_CHECK(stateMachine.GetTransitionCount() == 1);
+}
+
+static void CheckRejected(const Model* model, const ANIMATION_STATE_MACHINE_CONFIG& config)
+{
+	AnimationStateMachine stateMachine;
+	TEST_CHECK(!stateMachine.Init(model, config));
+	TEST_CHECK(!stateMachine.GetError().empty());
+	printf("rejected: %s\n", stateMachine.GetError().c_str());
+	TEST_CHECK(stateMachine.GetCurrentState() == ANIMATION_STATE_NONE);
+
+	// eƂ͉Ȃ
+	Pose pose;
+	pose.Resize(model->nodeNum);
+	for (unsigned int i = 0; i < ANIMATION_CONDITION_MAX + 1; i++) {
+		stateMachine.SetCondition(i, true);
+	}
+	stateMachine.Update(16.0f);
+	stateMachine.Evaluate(pose, 16.0f);
+	TEST_CHECK(stateMachine.GetCurrentState() == ANIMATION_STATE_NONE);
+	TEST_CHECK(stateMachine.GetTransitionCount() == 0);
+	TEST_CHECK(stateMachine.GetEventNum() == 0);
+
+	// `ŏ
+	TEST_CHECK(stateMachine.Init(model, MakeConfig(1)));
+	TEST_CHECK(stateMachine.GetError().empty());
+	TEST_CHECK(stateMachine.GetCurrentState() == stateMachine.GetStateIndex("idle"));
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+
+	CheckConditionLimit(model);
+	CheckRejected(model, MakeConfig(ANIMATION_CONDITION_MAX));
+
+	ANIMATION_STATE_MACHINE_CONFIG unknownState = MakeConfig(1);
+	unknownState.transitions[0].to = "run";
+	CheckRejected(model, unknownState);
+
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
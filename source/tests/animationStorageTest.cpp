@@ -0,0 +1,129 @@
+// =======================================================
+// animationStorageTest.cpp
+//
+// Animation::ReleaseKeys̃eXg
+// kETvǑɃL[t[Ə풓A
+// ĐʂƁAOɑ덷͂̂܂ܕςȂ
+// ͈͂̍LʒugbNkĂe덷Ɏ܂邱
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include <cstring>
+
+using namespace MG;
+
+static void CheckRelease(const char* name, bool compress)
+{
+	Animation* animation = LoadTestAnimation(name);
+	TEST_CHECK(!animation->ReleaseKeys());	// L[t[̂܂܂ł͉łȂ
+	if (compress) {
+		animation->Compress();
+	}
+	else {
+		animation->Resample();
+	}
+	ANIMATION_STORAGE_REPORT before = animation->GetStorageReport();
+
+	// O̍Đ
+	const unsigned int channelNum = animation->rawAnimation->channelNum;
+	const float frames = animation->rawAnimation->frames;
+	std::vector<F3> sizes, positions;
+	std::vector<Quaternion> rotates;
+	for (unsigned int i = 0; i < channelNum; i++) {
+		for (float frame = 0.0f; frame <= frames; frame += 0.5f) {
+			F3 size = {}, position = {};
+			Quaternion rotate = {};
+			animation->ApplyChannel(i, frame, &size, &position, &rotate);
+			sizes.push_back(size);
+			positions.push_back(position);
+			rotates.push_back(rotate);
+		}
+	}
+	std::vector<std::string> nodeNames;
+	for (unsigned int i = 0; i < channelNum; i++) {
+		nodeNames.push_back(animation->rawAnimation->channels[i].nodeName);
+	}
+
+	TEST_CHECK(animation->ReleaseKeys());
+	TEST_CHECK(animation->IsKeyReleased());
+	ANIMATION_STORAGE_REPORT after = animation->GetStorageReport();
+
+	TEST_CHECK(after.residentBytes < before.residentBytes);
+	TEST_CHECK(before.residentBytes - after.residentBytes + sizeof(ANIMATION_CHANNEL) * channelNum >= before.keyBytes);
+	TEST_CHECK(after.keyBytes == before.keyBytes);
+	TEST_CHECK(after.bytes == before.bytes);
+	TEST_CHECK(after.maxPositionError == before.maxPositionError);
+	TEST_CHECK(after.maxRotationError == before.maxRotationError);
+
+	// wb_[ƃ`l͎c
+	TEST_CHECK(animation->rawAnimation->channelNum == channelNum);
+	TEST_CHECK(animation->rawAnimation->frames == frames);
+	TEST_CHECK(animation->modelNodeChannels.size() == channelNum);
+	bool namesKept = true;
+	for (unsigned int i = 0; i < channelNum; i++) {
+		namesKept &= nodeNames[i] == animation->rawAnimation->channels[i].nodeName;
+		namesKept &= animation->modelNodeChannels[nodeNames[i]] == animation->rawAnimation->channels + i;
+		namesKept &= animation->rawAnimation->channels[i].rotationKeyNum == 0;
+	}
+	TEST_CHECK(namesKept);
+
+	// Đʂ͕ςȂ
+	size_t sample = 0;
+	bool samePose = true;
+	for (unsigned int i = 0; i < channelNum; i++) {
+		for (float frame = 0.0f; frame <= frames; frame += 0.5f, sample++) {
+			F3 size = {}, position = {};
+			Quaternion rotate = {};
+			animation->ApplyChannel(i, frame, &size, &position, &rotate);
+			samePose &= memcmp(&size, &sizes[sample], sizeof(F3)) == 0;
+			samePose &= memcmp(&position, &positions[sample], sizeof(F3)) == 0;
+			samePose &= memcmp(&rotate, &rotates[sample], sizeof(Quaternion)) == 0;
+		}
+	}
+	TEST_CHECK(samePose);
+
+	printf("%-24s %-8s: key %zu bytes, format %zu bytes, resident %zu -> %zu bytes\n",
+		name, compress ? "compress" : "resample", before.keyBytes, before.bytes, before.residentBytes, after.residentBytes);
+	ReleaseTestAnimation(animation);
+}
+
+// 16bit̗ʎq̈ii͈/65535je덷傫ʒugbN
+static void CheckWideRangeBudget()
+{
+	const unsigned int keyNum = 40;
+	std::vector<VECTOR_KEY> keys(keyNum);
+	for (unsigned int i = 0; i < keyNum; i++) {
+		keys[i] = { (float)i, { i * 25.0f + (i % 3) * 0.37f, sinf(i * 0.7f), 0.0f } };
+	}
+	ANIMATION_CHANNEL channel = { keyNum, 0, 0, keys.data(), nullptr, nullptr, "node" };
+	ANIMATION raw = { 30.0f, (float)(keyNum - 1), 1, &channel, "wide" };
+	Animation animation(0);
+	animation.rawAnimation = &raw;
+	animation.modelNodeChannels["node"] = &channel;
+
+	ANIMATION_ERROR_BUDGET budget;
+	animation.Compress(budget);
+	TEST_CHECK(animation.IsCompressed());
+
+	// ̃L[̈ʒuōőɂȂiǂL[߂ɂ敪`j
+	float maxError = 0.0f;
+	for (float frame = 0.0f; frame <= raw.frames; frame += 0.5f) {
+		F3 key = {}, position = {};
+		ApplyAnimation(&channel, frame, nullptr, &key, nullptr);
+		animation.ApplyChannel(0, frame, nullptr, &position, nullptr);
+		maxError = std::max(maxError, Distance(key, position));
+	}
+	TEST_CHECK(maxError <= budget.position + 1e-4f);
+	TEST_CHECK(animation.GetStorageReport().maxPositionError <= budget.position + 1e-4f);
+	printf("wide range position track: range %g, max error %g (budget %g)\n", keys.back().vector.x, maxError, budget.position);
+}
+
+int main()
+{
+	CheckWideRangeBudget();
+	CheckRelease("kumacchi_walk.mga", true);
+	CheckRelease("kumacchi_walk.mga", false);
+	CheckRelease("kumacchi_swing_down.mga", true);
+	return TEST_RESULT();
+}
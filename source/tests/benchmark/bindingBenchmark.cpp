@@ -0,0 +1,90 @@
+// =======================================================
+// bindingBenchmark.cpp
+//
+// AnimationBinding̃x`}[N
+// kumacchiwalkblinkd˂ĕ]Am[hŃ`lTꍇ
+// AnimationBindingňꍇ̎ԁA̕]̕nbVƊmۉ񐔂ׂ
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include <cstdlib>
+#include <new>
+
+using namespace MG;
+
+// mۉ񐔂𐔂
+static size_t g_allocationNum = 0;
+
+void* operator new(size_t size)
+{
+	g_allocationNum++;
+	void* p = malloc(size ? size : 1);
+	if (!p) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	free(p);
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	Animation* blink = LoadTestAnimation("kumacchi_blink.mga");
+	AnimationBinding walkBinding(model, walk);
+	AnimationBinding blinkBinding(model, blink);
+	AnimationCursor walkCursor, blinkCursor;
+	const int evaluationNum = 20000;
+
+	// OŒTꍇ́AAj[VƂɃm[h̃nbV
+	printf("nodes %u: string hashes per evaluation %u (name lookup), 0 (binding)\n", model->nodeNum, model->nodeNum * 2);
+
+	std::map<MODEL_NODE*, M4x4> worlds[2];
+	for (int pass = 0; pass < 2; pass++) {
+		const bool bind = pass == 1;
+		std::map<MODEL_NODE*, M4x4>& world = worlds[pass];
+		std::vector<ANIMATION_APPLICANT> warmup{
+			{ blink, 0.0f, &blinkCursor, bind ? &blinkBinding : nullptr },
+			{ walk, 0.0f, &walkCursor, bind ? &walkBinding : nullptr } };
+		LoadNodeWorldTransforms(model->rawModel->rootNode, M4x4::TranslatingMatrix({}), world, warmup);
+
+		size_t allocationNum = g_allocationNum;
+		TestTimer timer;
+		for (int i = 0; i < evaluationNum; i++) {
+			std::vector<ANIMATION_APPLICANT> applicants{
+				{ blink, (float)(i % 29), &blinkCursor, bind ? &blinkBinding : nullptr },
+				{ walk, (float)(i % 29), &walkCursor, bind ? &walkBinding : nullptr } };
+			LoadNodeWorldTransforms(model->rawModel->rootNode, M4x4::TranslatingMatrix({}), world, applicants);
+		}
+		double milliseconds = timer.GetMilliseconds();
+		printf("%-11s: %.1f ms / %d evaluations (%.2f us each), %.2f allocations per evaluation (1 is the applicant vector)\n",
+			bind ? "binding" : "name lookup", milliseconds, evaluationNum, milliseconds * 1000.0 / evaluationNum,
+			(double)(g_allocationNum - allocationNum) / evaluationNum);
+	}
+
+	// ʂɂȂ邱
+	float maxDifference = 0.0f;
+	for (auto& pair : worlds[0]) {
+		const float* m0 = (const float*)&pair.second;
+		const float* m1 = (const float*)&worlds[1][pair.first];
+		for (int e = 0; e < 16; e++) {
+			maxDifference = std::max(maxDifference, fabsf(m0[e] - m1[e]));
+		}
+	}
+	printf("max difference %g\n", maxDifference);
+
+	ReleaseTestAnimation(blink);
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return 0;
+}
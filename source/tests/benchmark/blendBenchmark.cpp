@@ -0,0 +1,115 @@
+// =======================================================
+// blendBenchmark.cpp
+//
+// ԂSIMDob`̃x`}[NiS{[/bj
+// 1. J[lṔFLerpBatchANlerpBatchAFastSlerpBatchASlerpBatch𖽗߃ZbgƂ
+// 2. p̕ԁFm[hƂ̃XJ[ŁiLerpABlendQuaternionjBlendPoses
+//    ߃ZbgƉ]̕ԕ@Ƃ
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "pose.h"
+#include "animationKernel.h"
+#include <random>
+
+using namespace MG;
+
+// Ƃ̔z
+struct SOA_BUFFER {
+	std::vector<float> x, y, z, w;
+	SOA_BUFFER(size_t num) : x(num), y(num), z(num), w(num) {}
+	F3_SOA GetF3() { return { x.data(), y.data(), z.data() }; }
+	QUATERNION_SOA GetQuaternion() { return { x.data(), y.data(), z.data(), w.data() }; }
+};
+
+static const char* kernelNames[] = { "scalar", "SSE", "AVX2" };
+
+// S{[/b
+template<typename FUNCTION>
+static double MeasureMegaBones(size_t boneNum, int repeatNum, FUNCTION function)
+{
+	function();
+	TestTimer timer;
+	for (int r = 0; r < repeatNum; r++) {
+		function();
+	}
+	return (double)boneNum * repeatNum / (timer.GetMilliseconds() * 1000.0);
+}
+
+int main()
+{
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> range01(0.0f, 1.0f);
+	const ANIMATION_KERNEL kernel = GetAnimationKernel();
+	const QUATERNION_BLEND_MODE blendMode = GetQuaternionBlendMode();
+
+	// J[lP
+	{
+		const size_t num = 4099;
+		const int repeatNum = 2000;
+		SOA_BUFFER a(num), b(num), out(num);
+		std::vector<float> t(num);
+		for (size_t i = 0; i < num; i++) {
+			Quaternion q0 = Quaternion::AxisRadian(Normalize(F3{ range(random), range(random), range(random) + 0.01f }), range(random) * PI);
+			Quaternion q1 = Quaternion::AxisRadian(Normalize(F3{ range(random), range(random), range(random) + 0.01f }), range(random) * PI);
+			a.x[i] = q0.x; a.y[i] = q0.y; a.z[i] = q0.z; a.w[i] = q0.w;
+			b.x[i] = q1.x; b.y[i] = q1.y; b.z[i] = q1.z; b.w[i] = q1.w;
+			t[i] = range01(random);
+		}
+		printf("kernel batch, %zu elements (Mbones/s)\n", num);
+		for (int k = 0; k <= (int)GetSupportedAnimationKernel(); k++) {
+			SetAnimationKernel((ANIMATION_KERNEL)k);
+			double lerp = MeasureMegaBones(num, repeatNum, [&]() { LerpBatch(a.GetF3(), b.GetF3(), t.data(), out.GetF3(), num); });
+			double nlerp = MeasureMegaBones(num, repeatNum, [&]() { NlerpBatch(a.GetQuaternion(), b.GetQuaternion(), t.data(), out.GetQuaternion(), num); });
+			double fastSlerp = MeasureMegaBones(num, repeatNum, [&]() { FastSlerpBatch(a.GetQuaternion(), b.GetQuaternion(), t.data(), out.GetQuaternion(), num); });
+			double slerp = MeasureMegaBones(num, repeatNum, [&]() { SlerpBatch(a.GetQuaternion(), b.GetQuaternion(), t.data(), out.GetQuaternion(), num); });
+			printf("  %-6s lerp %7.0f  nlerp %7.0f  fast slerp %7.0f  slerp %7.0f\n", kernelNames[k], lerp, nlerp, fastSlerp, slerp);
+		}
+	}
+
+	// p̕
+	{
+		const unsigned int nodeNum = 1003;
+		const int repeatNum = 5000;
+		Pose pose0(nodeNum), pose1(nodeNum), out(nodeNum);
+		for (Pose* pose : { &pose0, &pose1 }) {
+			NODE_TRANSFORM* locals = pose->GetLocals();
+			for (unsigned int i = 0; i < nodeNum; i++) {
+				locals[i].scale = { 1.0f + range(random) * 0.5f, 1.0f + range(random) * 0.5f, 1.0f + range(random) * 0.5f };
+				locals[i].position = { range(random) * 10.0f, range(random) * 10.0f, range(random) * 10.0f };
+				locals[i].rotate = Quaternion::AxisRadian(Normalize(F3{ range(random), range(random), range(random) + 0.01f }), range(random) * PI);
+			}
+		}
+		printf("pose blend, %u nodes (Mbones/s)\n", nodeNum);
+		const QUATERNION_BLEND_MODE modes[] = { QUATERNION_BLEND_NLERP, QUATERNION_BLEND_FAST_SLERP, QUATERNION_BLEND_SLERP };
+		const char* modeNames[] = { "nlerp", "fast slerp", "slerp" };
+		for (int m = 0; m < 3; m++) {
+			SetQuaternionBlendMode(modes[m]);
+			double perNode = MeasureMegaBones(nodeNum, repeatNum, [&]() {
+				const NODE_TRANSFORM* locals0 = pose0.GetLocals();
+				const NODE_TRANSFORM* locals1 = pose1.GetLocals();
+				NODE_TRANSFORM* locals = out.GetLocals();
+				for (unsigned int i = 0; i < nodeNum; i++) {
+					locals[i] = {
+						Lerp(locals0[i].scale, locals1[i].scale, 0.3f),
+						BlendQuaternion(locals0[i].rotate, locals1[i].rotate, 0.3f),
+						Lerp(locals0[i].position, locals1[i].position, 0.3f)
+					};
+				}
+			});
+			printf("  %-10s per node %7.0f  BlendPoses", modeNames[m], perNode);
+			for (int k = 0; k <= (int)GetSupportedAnimationKernel(); k++) {
+				SetAnimationKernel((ANIMATION_KERNEL)k);
+				double batch = MeasureMegaBones(nodeNum, repeatNum, [&]() { BlendPoses(pose0, pose1, 0.3f, out); });
+				printf(" %s %7.0f", kernelNames[k], batch);
+			}
+			printf("\n");
+		}
+	}
+
+	SetAnimationKernel(kernel);
+	SetQuaternionBlendMode(blendMode);
+	return 0;
+}
@@ -0,0 +1,74 @@
+// =======================================================
+// crowdBenchmark.cpp
+//
+// CrowdEvaluator̃x`}[N
+// kumacchi 512́iwalkswing_downj1A2A4A8A16Xbhŕ]A
+// ̕]ԁA1Xbhɑ΂鑬xÂ]ʂƂ̍o
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "crowd.h"
+
+using namespace MG;
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	Animation* swing = LoadTestAnimation("kumacchi_swing_down.mga");
+	AnimationBinding walkBinding(model, walk);
+	AnimationBinding swingBinding(model, swing);
+
+	const unsigned int characterNum = 512;
+	std::vector<AnimationCursor> cursors(characterNum);
+	std::vector<Pose> poses(characterNum);
+	std::vector<std::vector<ANIMATION_APPLICANT>> applicants;
+	std::vector<CROWD_JOB> jobs;
+	applicants.reserve(characterNum);
+	for (unsigned int i = 0; i < characterNum; i++) {
+		bool swinging = i % 3 == 0;
+		applicants.push_back({ { swinging ? swing : walk, (float)(i % 29), &cursors[i], swinging ? &swingBinding : &walkBinding } });
+	}
+	for (unsigned int i = 0; i < characterNum; i++) {
+		jobs.push_back({ model, &applicants[i], M4x4::TranslatingMatrix({ (float)i, 0.0f, 0.0f }), &poses[i] });
+	}
+
+	// ̂]
+	std::vector<Pose> references(characterNum);
+	for (unsigned int i = 0; i < characterNum; i++) {
+		LoadNodeWorldTransforms(model, jobs[i].worldTransform, references[i], applicants[i]);
+	}
+
+	printf("%u characters, %u nodes, %u hardware threads\n", characterNum, model->nodeNum, std::thread::hardware_concurrency());
+	const int repeatNum = 50;
+	double singleThread = 0.0;
+	for (unsigned int threadNum : { 1u, 2u, 4u, 8u, 16u }) {
+		CrowdEvaluator crowd(threadNum);
+		crowd.Evaluate(jobs);
+
+		float maxDifference = 0.0f;
+		for (unsigned int i = 0; i < characterNum; i++) {
+			const float* a = (const float*)poses[i].GetWorlds();
+			const float* b = (const float*)references[i].GetWorlds();
+			for (size_t e = 0; e < model->nodeNum * sizeof(*poses[i].GetWorlds()) / sizeof(float); e++) {
+				maxDifference = std::max(maxDifference, fabsf(a[e] - b[e]));
+			}
+		}
+
+		TestTimer timer;
+		for (int r = 0; r < repeatNum; r++) {
+			crowd.Evaluate(jobs);
+		}
+		double milliseconds = timer.GetMilliseconds() / repeatNum;
+		if (threadNum == 1) {
+			singleThread = milliseconds;
+		}
+		printf("threads %2u: %.2f ms per evaluation, speedup %.2fx, max difference %g\n", threadNum, milliseconds, singleThread / milliseconds, maxDifference);
+	}
+
+	ReleaseTestAnimation(swing);
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return 0;
+}
@@ -0,0 +1,168 @@
+// =======================================================
+// cubicBenchmark.cpp
+//
+// `ԂƎOG~[gԁiComputeCubicTangentsj̔r
+// 1. 炩ȍgbNL[ԊuƂɃTvOA͉Ƃ̌덷A
+//    iőƓ敽ρjAAJ[\t̏Đ̈Tv̎
+//    i]L[XἉŊi[gbNj
+// 2. kumacchĩNbvFL[̌덷AL[Ԃ̐`Ƃ̍A]L[̊Ԃ̍ő̊px
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include <algorithm>
+
+using namespace MG;
+
+// 炩Ȋ̓
+static F3 GetReferencePosition(float frame)
+{
+	return { sinf(frame * 0.11f) * 2.0f, cosf(frame * 0.07f) + 0.3f * sinf(frame * 0.23f), frame * 0.01f };
+}
+
+static Quaternion GetReferenceRotation(float frame)
+{
+	return Normalize(Quaternion::AxisYRadian(sinf(frame * 0.05f) * 2.5f) * Quaternion::AxisXRadian(0.8f * sinf(frame * 0.13f)));
+}
+
+// ̉]̊Ԃ̊pxiWAjÄႢ͓]
+static float GetRotationError(const Quaternion& a, Quaternion b)
+{
+	if (Dot(a, b) < 0.0f) {
+		b = { -b.x, -b.y, -b.z, -b.w };
+	}
+	float chord = sqrtf((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z) + (a.w - b.w) * (a.w - b.w));
+	return 4.0f * asinf(std::min(1.0f, chord * 0.5f));
+}
+
+// `l̍Aj[V
+struct SYNTHETIC_TRACK {
+	std::vector<VECTOR_KEY> positionKeys;
+	std::vector<QUATERNION_KEY> rotationKeys;
+	ANIMATION_CHANNEL channel;
+	ANIMATION animation;
+};
+
+static void CreateTrack(SYNTHETIC_TRACK& track, float frames, int keyStep, bool flipSigns)
+{
+	for (float frame = 0.0f; frame <= frames; frame += keyStep) {
+		track.positionKeys.push_back({ frame, GetReferencePosition(frame) });
+		track.rotationKeys.push_back({ frame, GetReferenceRotation(frame) });
+	}
+	// XἉŊi[iGNX|[^[肪j
+	for (size_t i = 0; flipSigns && i < track.rotationKeys.size(); i += 3) {
+		Quaternion& rotate = track.rotationKeys[i].rotate;
+		rotate = { -rotate.x, -rotate.y, -rotate.z, -rotate.w };
+	}
+	track.channel = { (unsigned int)track.positionKeys.size(), 0, (unsigned int)track.rotationKeys.size(),
+		track.positionKeys.data(), nullptr, track.rotationKeys.data(), "node" };
+	track.animation = { 30.0f, frames, 1, &track.channel, "synthetic" };
+}
+
+static void BindTrack(Animation& animation, SYNTHETIC_TRACK& track)
+{
+	animation.rawAnimation = &track.animation;
+	animation.modelNodeChannels["node"] = &track.channel;
+}
+
+// őƓa
+struct SAMPLE_ERROR {
+	float max = 0.0f;
+	double squareSum = 0.0;
+	void Add(float error)
+	{
+		max = std::max(max, error);
+		squareSum += (double)error * error;
+	}
+	double GetRms(int sampleNum) const { return sqrt(squareSum / sampleNum); }
+};
+
+// J[\t̏ĐATṽimb
+static double MeasureNanoseconds(const Animation& animation, float lastFrame, double& sum)
+{
+	const int sampleNum = 4000000;
+	AnimationCursor cursor;
+	TestTimer timer;
+	for (int i = 0; i < sampleNum; i++) {
+		F3 position;
+		Quaternion rotate;
+		animation.ApplyChannel(0, fmodf(i * 0.37f, lastFrame), nullptr, &position, &rotate, &cursor);
+		sum += position.x + rotate.w;
+	}
+	return timer.GetMilliseconds() * 1e6 / sampleNum;
+}
+
+int main()
+{
+	const float frames = 240.0f;
+	double sum = 0.0;
+	printf("smooth synthetic track, %g frames, error against the analytic curve every 1/8 frame\n", frames);
+	for (bool flipSigns : { false, true }) {
+		for (int keyStep : { 1, 2, 4, 8, 16 }) {
+			if (flipSigns && keyStep != 4) {
+				continue;
+			}
+			SYNTHETIC_TRACK track;
+			CreateTrack(track, frames, keyStep, flipSigns);
+			Animation linear(0), cubic(0);
+			BindTrack(linear, track);
+			BindTrack(cubic, track);
+			cubic.ComputeCubicTangents();
+
+			const float lastFrame = track.positionKeys.back().frame;
+			SAMPLE_ERROR linearPosition, linearRotation, cubicPosition, cubicRotation;
+			int sampleNum = 0;
+			for (float frame = 0.0f; frame <= lastFrame; frame += 0.125f) {
+				F3 position;
+				Quaternion rotate;
+				linear.ApplyChannel(0, frame, nullptr, &position, &rotate);
+				linearPosition.Add(Distance(position, GetReferencePosition(frame)));
+				linearRotation.Add(GetRotationError(rotate, GetReferenceRotation(frame)));
+				cubic.ApplyChannel(0, frame, nullptr, &position, &rotate);
+				cubicPosition.Add(Distance(position, GetReferencePosition(frame)));
+				cubicRotation.Add(GetRotationError(rotate, GetReferenceRotation(frame)));
+				sampleNum++;
+			}
+			double linearNanoseconds = MeasureNanoseconds(linear, lastFrame, sum);
+			double cubicNanoseconds = MeasureNanoseconds(cubic, lastFrame, sum);
+			printf("  %skey every %2d frames (%3zu keys), max / rms: linear pos %.5f / %.5f rot %.5f / %.5f | cubic pos %.5f / %.5f rot %.5f / %.5f | bytes %5zu -> %5zu | %.1f -> %.1f ns/sample\n",
+				flipSigns ? "sign-flipped " : "", keyStep, track.positionKeys.size(),
+				linearPosition.max, linearPosition.GetRms(sampleNum), linearRotation.max, linearRotation.GetRms(sampleNum),
+				cubicPosition.max, cubicPosition.GetRms(sampleNum), cubicRotation.max, cubicRotation.GetRms(sampleNum),
+				linear.GetStorageReport().bytes, cubic.GetStorageReport().bytes, linearNanoseconds, cubicNanoseconds);
+		}
+	}
+
+	// NbvFL[ł͌̃L[ƈvAL[ԂŐ`ƈႤ
+	for (const char* name : { "kumacchi_walk.mga", "kumacchi_swing_down.mga" }) {
+		Animation* animation = LoadTestAnimation(name);
+		animation->ComputeCubicTangents();
+		const ANIMATION* raw = animation->rawAnimation;
+		float onKeyError = 0.0f;
+		float maxKeyArc = 0.0f;
+		unsigned int maxRotationKeyNum = 0;
+		for (unsigned int c = 0; c < raw->channelNum; c++) {
+			const ANIMATION_CHANNEL& channel = raw->channels[c];
+			for (unsigned int k = 0; k < channel.positionKeyNum; k++) {
+				F3 position;
+				animation->ApplyChannel(c, channel.positionKeys[k].frame, nullptr, &position, nullptr);
+				onKeyError = std::max(onKeyError, Distance(position, channel.positionKeys[k].vector));
+			}
+			for (unsigned int k = 0; k < channel.rotationKeyNum; k++) {
+				Quaternion rotate;
+				animation->ApplyChannel(c, channel.rotationKeys[k].frame, nullptr, nullptr, &rotate);
+				onKeyError = std::max(onKeyError, GetRotationError(rotate, Normalize(channel.rotationKeys[k].rotate)));
+				if (k > 0) {
+					maxKeyArc = std::max(maxKeyArc, GetRotationError(channel.rotationKeys[k - 1].rotate, channel.rotationKeys[k].rotate));
+				}
+			}
+			maxRotationKeyNum = std::max(maxRotationKeyNum, channel.rotationKeyNum);
+		}
+		ANIMATION_STORAGE_REPORT report = animation->GetStorageReport();
+		printf("%s: up to %u rotation keys, largest arc between keys %.2f rad, on-key error %.2g, cubic against linear between keys pos %.4f rot %.4f rad, bytes %zu -> %zu\n",
+			name, maxRotationKeyNum, maxKeyArc, onKeyError, report.maxPositionError, report.maxRotationError, report.keyBytes, report.bytes);
+		ReleaseTestAnimation(animation);
+	}
+	printf("checksum %g\n", sum);
+	return 0;
+}
@@ -0,0 +1,112 @@
+// =======================================================
+// keySearchBenchmark.cpp
+//
+// L[t[T̃x`}[N
+// 10000L[̃`l0.5t[݂ŏĐāA
+// 擪̐`TiȑO̎jAJ[\A񕪒Tׂ
+// ĐEׁEtĐ̎Ōʂ`Tƈv邱Ƃm߂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include <cstring>
+#include <random>
+
+using namespace MG;
+
+// ȑO̎F擪玟̃L[T
+static void ApplyLinearSearch(const ANIMATION_CHANNEL* channel, float frame, F3* position)
+{
+	const VECTOR_KEY* minKey = channel->positionKeys;
+	const VECTOR_KEY* maxKey = minKey;
+	for (unsigned int i = 0; i < channel->positionKeyNum; i++) {
+		if (frame < channel->positionKeys[i].frame) {
+			maxKey = channel->positionKeys + i;
+			break;
+		}
+		minKey = channel->positionKeys + i;
+		maxKey = minKey;
+	}
+	float d = maxKey->frame - minKey->frame;
+	if (d > 0.0f) {
+		float t = (frame - minKey->frame) / d;
+		*position = minKey->vector * (1.0f - t) + maxKey->vector * t;
+	}
+	else {
+		*position = minKey->vector;
+	}
+}
+
+int main()
+{
+	const unsigned int keyNum = 10000;
+	std::vector<VECTOR_KEY> keys(keyNum);
+	for (unsigned int i = 0; i < keyNum; i++) {
+		keys[i] = { i * 1.5f + 2.0f, { (float)i, (float)(i * i % 7), 1.0f } };
+	}
+	ANIMATION_CHANNEL channel = {};
+	channel.positionKeyNum = keyNum;
+	channel.positionKeys = keys.data();
+	const float lastFrame = keys.back().frame;
+
+	// ʂ̈v
+	{
+		std::mt19937 random(1);
+		std::uniform_real_distribution<float> range(-10.0f, lastFrame + 10.0f);
+		std::vector<float> frames;
+		for (float frame = -5.0f; frame < lastFrame + 10.0f; frame += 0.37f) {
+			frames.push_back(frame);
+		}
+		for (int i = 0; i < 2000; i++) {
+			frames.push_back(range(random));
+		}
+		for (float frame = lastFrame + 10.0f; frame > -5.0f; frame -= 0.9f) {
+			frames.push_back(frame);
+		}
+		CHANNEL_CURSOR cursor = {};
+		unsigned int mismatchNum = 0;
+		for (float frame : frames) {
+			F3 linear = {}, cursorPosition = {}, binary = {};
+			ApplyLinearSearch(&channel, frame, &linear);
+			ApplyAnimation(&channel, frame, nullptr, &cursorPosition, nullptr, &cursor);
+			ApplyAnimation(&channel, frame, nullptr, &binary, nullptr, nullptr);
+			if (memcmp(&linear, &cursorPosition, sizeof(F3)) || memcmp(&linear, &binary, sizeof(F3))) {
+				mismatchNum++;
+			}
+		}
+		printf("%u keys: %u mismatches in %zu samples (forward, random, backward)\n", keyNum, mismatchNum, frames.size());
+	}
+
+	// Đ
+	const int repeatNum = 3;
+	unsigned int sampleNum = 0;
+	for (float frame = 0.0f; frame < lastFrame; frame += 0.5f) {
+		sampleNum++;
+	}
+	sampleNum *= repeatNum;
+	float sum = 0.0f;
+	double milliseconds[3];
+	for (int method = 0; method < 3; method++) {
+		CHANNEL_CURSOR cursor = {};
+		TestTimer timer;
+		for (int r = 0; r < repeatNum; r++) {
+			for (float frame = 0.0f; frame < lastFrame; frame += 0.5f) {
+				F3 position = {};
+				if (method == 0) {
+					ApplyLinearSearch(&channel, frame, &position);
+				}
+				else {
+					ApplyAnimation(&channel, frame, nullptr, &position, nullptr, method == 1 ? &cursor : nullptr);
+				}
+				sum += position.x;
+			}
+		}
+		milliseconds[method] = timer.GetMilliseconds();
+	}
+	printf("forward playback, %u samples: linear %.1f ms (%.1f ns each), cursor %.2f ms (%.1f ns each), binary search %.2f ms (%.1f ns each) [%g]\n",
+		sampleNum,
+		milliseconds[0], milliseconds[0] * 1e6 / sampleNum,
+		milliseconds[1], milliseconds[1] * 1e6 / sampleNum,
+		milliseconds[2], milliseconds[2] * 1e6 / sampleNum, sum);
+	return 0;
+}
@@ -0,0 +1,131 @@
+// =======================================================
+// skinningBenchmark.cpp
+//
+// CPUXLjÕx`}[N
+// kumacchȋSbV̒_ɂ܂Ƃ߁ASKIN_PALETTE_MAX{̃{[̏d݂𗐐ŕt
+// 1. ߃ZbgƂSkinVerticesFt[̎ԁAS_/bA{x̎QƂƂ̌덷
+// 2. SkinningEvaluator̃XbhƂ̎ԂƁAPXbhƂ̌ʂ̈v
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "pose.h"
+#include "skinning.h"
+#include "animationKernel.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+using namespace MG;
+
+static const char* kernelNames[] = { "scalar", "SSE", "AVX2" };
+
+// t[̃~b
+template<typename FUNCTION>
+static double MeasureMilliseconds(int repeatNum, FUNCTION function)
+{
+	function();
+	TestTimer timer;
+	for (int r = 0; r < repeatNum; r++) {
+		function();
+	}
+	return timer.GetMilliseconds() / repeatNum;
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	AnimationCursor cursor;
+	std::vector<ANIMATION_APPLICANT> applicants{ { walk, 7.0f, &cursor, &binding } };
+	Pose bindPose, pose;
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), bindPose);
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), pose, applicants);
+
+	// SbV̒_Ɨ̏d
+	std::vector<VERTEX> vertices;
+	for (unsigned int m = 0; m < model->rawModel->meshNum; m++) {
+		const MESH* mesh = model->rawModel->meshes + m;
+		vertices.insert(vertices.end(), mesh->vertices, mesh->vertices + mesh->vertexNum);
+	}
+	const unsigned int vertexNum = (unsigned int)vertices.size();
+	const unsigned int boneNum = std::min<unsigned int>(SKIN_PALETTE_MAX, model->nodeNum);
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> range01(0.0f, 1.0f);
+	std::vector<VERTEX_BONE_WEIGHT> weights(vertexNum);
+	for (VERTEX_BONE_WEIGHT& weight : weights) {
+		float sum = 0.0f;
+		for (int k = 0; k < 4; k++) {
+			weight.boneIndexes[k] = random() % boneNum;
+			weight.weights[k] = range01(random);
+			sum += weight.weights[k];
+		}
+		for (int k = 0; k < 4; k++) {
+			weight.weights[k] /= sum;
+		}
+	}
+	std::vector<MESH_BONE> bones;
+	for (unsigned int b = 0; b < boneNum; b++) {
+		bones.push_back({ bindPose.GetWorld(b).Inverse(), model->rawModel->rootNode + b });
+	}
+	std::vector<M3x4> palette(boneNum);
+	BuildSkinPalette(model, pose, bones.data(), boneNum, palette.data());
+
+	// VF[_[Ɠis񂲂Ƃɕϊďd݂őj̔{x̎Q
+	std::vector<double> reference(vertexNum * 6);
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		double position[3] = {}, normal[3] = {};
+		const F3& p = vertices[v].position;
+		const F3& n = vertices[v].normal;
+		for (int k = 0; k < 4; k++) {
+			const float* m = &palette[weights[v].boneIndexes[k]]._v00;
+			double w = weights[v].weights[k];
+			for (int r = 0; r < 3; r++) {
+				position[r] += w * (m[r * 4] * (double)p.x + m[r * 4 + 1] * (double)p.y + m[r * 4 + 2] * (double)p.z + m[r * 4 + 3]);
+				normal[r] += w * (m[r * 4] * (double)n.x + m[r * 4 + 1] * (double)n.y + m[r * 4 + 2] * (double)n.z);
+			}
+		}
+		double length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		for (int r = 0; r < 3; r++) {
+			reference[v * 6 + r] = position[r];
+			reference[v * 6 + 3 + r] = length > 0.0 ? normal[r] / length : normal[r];
+		}
+	}
+
+	const int repeatNum = 2000;
+	std::vector<F3> positions(vertexNum), normals(vertexNum);
+	printf("%u vertices, %u bones\n", vertexNum, boneNum);
+	const ANIMATION_KERNEL kernel = GetAnimationKernel();
+	for (int k = 0; k <= (int)GetSupportedAnimationKernel(); k++) {
+		SetAnimationKernel((ANIMATION_KERNEL)k);
+		double milliseconds = MeasureMilliseconds(repeatNum, [&]() { SkinVertices(vertices.data(), weights.data(), vertexNum, palette.data(), positions.data(), normals.data()); });
+		double positionError = 0.0, normalError = 0.0;
+		for (unsigned int v = 0; v < vertexNum; v++) {
+			const float* position = &positions[v].x;
+			const float* normal = &normals[v].x;
+			for (int r = 0; r < 3; r++) {
+				positionError = std::max(positionError, fabs(position[r] - reference[v * 6 + r]));
+				normalError = std::max(normalError, fabs(normal[r] - reference[v * 6 + 3 + r]));
+			}
+		}
+		printf("  %-6s %8.1f us/frame, %7.1f Mverts/s, max error position %.2g normal %.2g\n",
+			kernelNames[k], milliseconds * 1000.0, vertexNum / milliseconds / 1000.0, positionError, normalError);
+	}
+	SetAnimationKernel(kernel);
+
+	// XbhƁAʂ͒PXbhSkinVerticesƈv͂
+	SkinVertices(vertices.data(), weights.data(), vertexNum, palette.data(), positions.data(), normals.data());
+	for (unsigned int threadNum : { 1u, 2u, 4u }) {
+		SkinningEvaluator evaluator(threadNum);
+		std::vector<F3> threadPositions(vertexNum), threadNormals(vertexNum);
+		double milliseconds = MeasureMilliseconds(repeatNum, [&]() { evaluator.SkinVertices(vertices.data(), weights.data(), vertexNum, palette.data(), threadPositions.data(), threadNormals.data()); });
+		bool identical = memcmp(threadPositions.data(), positions.data(), vertexNum * sizeof(F3)) == 0
+			&& memcmp(threadNormals.data(), normals.data(), vertexNum * sizeof(F3)) == 0;
+		printf("  evaluator %u threads %8.1f us/frame, identical %s\n", threadNum, milliseconds * 1000.0, identical ? "yes" : "no");
+	}
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return 0;
+}
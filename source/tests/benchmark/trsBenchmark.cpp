@@ -0,0 +1,90 @@
+// =======================================================
+// trsBenchmark.cpp
+//
+// FromTRS̃x`}[N
+// gE]Eړ̍sĊ|ꍇiȑO̎jƁA
+// ڑgݗĂĐe̍s|FromTRS̈m[h̎Ԃƌ덷ׂ
+// kumacchiUpdateNodeWorldTransforms̎Ԃo
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "pose.h"
+#include <random>
+
+using namespace MG;
+
+int main()
+{
+	const int nodeNum = 4096;
+	std::mt19937 random(3);
+	std::uniform_real_distribution<float> range(-2.0f, 2.0f);
+	std::vector<F3> scales(nodeNum), positions(nodeNum);
+	std::vector<Quaternion> rotates(nodeNum);
+	std::vector<M4x4> parents(nodeNum), separate(nodeNum), fused(nodeNum);
+	for (int i = 0; i < nodeNum; i++) {
+		scales[i] = { range(random), range(random), range(random) };
+		positions[i] = { range(random), range(random), range(random) };
+		rotates[i] = Quaternion::AxisRadian(Normalize(F3{ range(random), range(random), range(random) + 0.01f }), range(random));
+		parents[i] = M4x4::ScalingMatrix({ range(random), range(random), range(random) })
+			* M4x4::RotatingMatrix(Quaternion::AxisYRadian(range(random)))
+			* M4x4::TranslatingMatrix({ range(random), range(random), range(random) });
+	}
+
+	// 덷
+	float localDifference = 0.0f;
+	float parentDifference = 0.0f;
+	for (int i = 0; i < nodeNum; i++) {
+		M4x4 local = M4x4::ScalingMatrix(scales[i]) * M4x4::RotatingMatrix(rotates[i]) * M4x4::TranslatingMatrix(positions[i]);
+		M4x4 fusedLocal = M4x4::FromTRS(scales[i], rotates[i], positions[i]);
+		M4x4 world = local * parents[i];
+		M4x4 fusedWorld = M4x4::FromTRS(scales[i], rotates[i], positions[i], parents[i]);
+		for (int e = 0; e < 16; e++) {
+			localDifference = std::max(localDifference, fabsf(((float*)&local)[e] - ((float*)&fusedLocal)[e]));
+			parentDifference = std::max(parentDifference, fabsf(((float*)&world)[e] - ((float*)&fusedWorld)[e]));
+		}
+	}
+	printf("max difference: local %g, with parent %g\n", localDifference, parentDifference);
+
+	// 
+	const int repeatNum = 500;
+	float sum = 0.0f;
+	TestTimer separateTimer;
+	for (int r = 0; r < repeatNum; r++) {
+		for (int i = 0; i < nodeNum; i++) {
+			separate[i] = M4x4::ScalingMatrix(scales[i]) * M4x4::RotatingMatrix(rotates[i]) * M4x4::TranslatingMatrix(positions[i]) * parents[i];
+		}
+		sum += separate[r % nodeNum]._v00;
+	}
+	double separateMilliseconds = separateTimer.GetMilliseconds();
+	TestTimer fusedTimer;
+	for (int r = 0; r < repeatNum; r++) {
+		for (int i = 0; i < nodeNum; i++) {
+			fused[i] = M4x4::FromTRS(scales[i], rotates[i], positions[i], parents[i]);
+		}
+		sum += fused[r % nodeNum]._v00;
+	}
+	double fusedMilliseconds = fusedTimer.GetMilliseconds();
+	const double sampleNum = (double)nodeNum * repeatNum;
+	printf("S * R * T * parent %.1f ns/node, FromTRS %.1f ns/node (%.2fx) [%g]\n",
+		separateMilliseconds * 1e6 / sampleNum, fusedMilliseconds * 1e6 / sampleNum, separateMilliseconds / fusedMilliseconds, sum);
+
+	// kumacchĩ[hs̍XV
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	AnimationCursor cursor;
+	std::vector<ANIMATION_APPLICANT> applicants{ { walk, 3.0f, &cursor, &binding } };
+	Pose pose;
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), pose, applicants);
+	const int updateNum = 20000;
+	TestTimer updateTimer;
+	for (int r = 0; r < updateNum; r++) {
+		UpdateNodeWorldTransforms(model, M4x4::TranslatingMatrix({}), pose);
+	}
+	printf("UpdateNodeWorldTransforms (%u nodes): %.2f us\n", model->nodeNum, updateTimer.GetMilliseconds() * 1000.0 / updateNum);
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return 0;
+}
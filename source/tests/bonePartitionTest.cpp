@@ -0,0 +1,211 @@
+// =======================================================
+// bonePartitionTest.cpp
+//
+// PartitionMeshBones̃eXg
+// ~iɃ{[Ԏ葫̂悤ȃbVj𕪂āA
+//   {[̏AOp`ߕsȂc邱ƁA{[ԍ̕tւA
+//   _̓̕v
+// m߂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "bonePartition.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+
+using namespace MG;
+
+// ringNum x segmentNum̉~A{[boneNum{
+// randomBonesȂe{[ׁ͖AłȂ΍̋߂4{
+struct SYNTHETIC_MESH {
+	std::vector<VERTEX> vertices;
+	std::vector<unsigned int> vertexIndexes;
+	std::vector<VERTEX_BONE_WEIGHT> boneWeights;
+	std::vector<BONE> bones;
+	MESH mesh;
+};
+
+static void CreateCylinder(SYNTHETIC_MESH& synthetic, unsigned int ringNum, unsigned int segmentNum, unsigned int boneNum, bool randomBones)
+{
+	std::mt19937 random(3);
+	for (unsigned int r = 0; r < ringNum; r++) {
+		for (unsigned int s = 0; s < segmentNum; s++) {
+			float angle = s * 2.0f * PI / segmentNum;
+			VERTEX vertex = {};
+			vertex.position = { cosf(angle), (float)r / (ringNum - 1) * 10.0f, sinf(angle) };
+			vertex.normal = { cosf(angle), 0.0f, sinf(angle) };
+			synthetic.vertices.push_back(vertex);
+
+			VERTEX_BONE_WEIGHT boneWeight;
+			float height = (float)r / (ringNum - 1) * (boneNum - 1);
+			float sum = 0.0f;
+			for (int k = 0; k < 4; k++) {
+				int bone = randomBones ? (int)(random() % boneNum) : std::min<int>(boneNum - 1, std::max<int>(0, (int)height - 1 + k));
+				boneWeight.boneIndexes[k] = bone;
+				boneWeight.weights[k] = 1.0f / (1.0f + fabsf(height - bone));
+				sum += boneWeight.weights[k];
+			}
+			for (int k = 0; k < 4; k++) {
+				boneWeight.weights[k] /= sum;
+			}
+			synthetic.boneWeights.push_back(boneWeight);
+		}
+	}
+	for (unsigned int r = 0; r + 1 < ringNum; r++) {
+		for (unsigned int s = 0; s < segmentNum; s++) {
+			unsigned int a = r * segmentNum + s;
+			unsigned int b = r * segmentNum + (s + 1) % segmentNum;
+			synthetic.vertexIndexes.insert(synthetic.vertexIndexes.end(), { a, a + segmentNum, b, b, a + segmentNum, b + segmentNum });
+		}
+	}
+	synthetic.bones.resize(boneNum);
+	synthetic.mesh = {};
+	synthetic.mesh.primitiveType = PRIMITIVE_TYPE_TRIANGLE;
+	synthetic.mesh.vertexNum = (unsigned int)synthetic.vertices.size();
+	synthetic.mesh.vertexIndexNum = (unsigned int)synthetic.vertexIndexes.size();
+	synthetic.mesh.boneNum = boneNum;
+	synthetic.mesh.vertices = synthetic.vertices.data();
+	synthetic.mesh.vertexIndexes = synthetic.vertexIndexes.data();
+	synthetic.mesh.bones = synthetic.bones.data();
+	synthetic.mesh.boneWeights = synthetic.boneWeights.data();
+}
+
+static void CheckPartitions(const char* name, const SYNTHETIC_MESH& synthetic, unsigned int maxBones, unsigned int expectedPartitionMin)
+{
+	std::vector<BONE_PARTITION> partitions;
+	bool succeeded = PartitionMeshBones(&synthetic.mesh, maxBones, partitions);
+	TEST_CHECK(succeeded);
+	if (!succeeded) {
+		return;
+	}
+	TEST_CHECK(partitions.size() >= expectedPartitionMin);
+
+	// ̎Op`i_ԍ̑gjƁAbV猳̔ԍɖ߂Op`W
+	std::vector<std::array<unsigned int, 3>> sourceTriangles, partitionTriangles;
+	for (size_t i = 0; i + 2 < synthetic.vertexIndexes.size(); i += 3) {
+		sourceTriangles.push_back({ synthetic.vertexIndexes[i], synthetic.vertexIndexes[i + 1], synthetic.vertexIndexes[i + 2] });
+	}
+
+	unsigned int vertexNum = 0;
+	unsigned int maxBoneNum = 0;
+	bool bonesInLimit = true;
+	bool indexesInRange = true;
+	bool weightsRemapped = true;
+	bool verticesCopied = true;
+	for (const BONE_PARTITION& partition : partitions) {
+		bonesInLimit &= partition.bones.size() <= maxBones;
+		maxBoneNum = std::max(maxBoneNum, (unsigned int)partition.bones.size());
+		vertexNum += (unsigned int)partition.vertices.size();
+		TEST_CHECK(partition.vertices.size() == partition.vertexSources.size());
+		TEST_CHECK(partition.boneWeights.size() == partition.vertexSources.size());
+
+		for (size_t i = 0; i + 2 < partition.vertexIndexes.size(); i += 3) {
+			partitionTriangles.push_back({
+				partition.vertexSources[partition.vertexIndexes[i]],
+				partition.vertexSources[partition.vertexIndexes[i + 1]],
+				partition.vertexSources[partition.vertexIndexes[i + 2]] });
+		}
+
+		// ̃{[ԍ猳̃{[ԍɖ߂ƁȀd݂ƈv
+		for (size_t v = 0; v < partition.vertexSources.size(); v++) {
+			unsigned int source = partition.vertexSources[v];
+			const VERTEX_BONE_WEIGHT& sourceWeight = synthetic.boneWeights[source];
+			const VERTEX_BONE_WEIGHT& localWeight = partition.boneWeights[v];
+			verticesCopied &= memcmp(&partition.vertices[v], &synthetic.vertices[source], sizeof(VERTEX)) == 0;
+			for (int k = 0; k < 4; k++) {
+				indexesInRange &= localWeight.boneIndexes[k] < partition.bones.size();
+				weightsRemapped &= localWeight.weights[k] == sourceWeight.weights[k];
+				if (sourceWeight.weights[k] != 0.0f && localWeight.boneIndexes[k] < partition.bones.size()) {
+					weightsRemapped &= partition.bones[localWeight.boneIndexes[k]] == sourceWeight.boneIndexes[k];
+				}
+			}
+		}
+	}
+	TEST_CHECK(bonesInLimit);
+	TEST_CHECK(indexesInRange);
+	TEST_CHECK(weightsRemapped);
+	TEST_CHECK(verticesCopied);
+
+	std::sort(sourceTriangles.begin(), sourceTriangles.end());
+	std::sort(partitionTriangles.begin(), partitionTriangles.end());
+	TEST_CHECK(sourceTriangles == partitionTriangles);
+
+	// v
+	BONE_PARTITION_STATS stats = GetBonePartitionStats(&synthetic.mesh, partitions);
+	TEST_CHECK(stats.partitionNum == partitions.size());
+	TEST_CHECK(stats.sourceVertexNum == synthetic.mesh.vertexNum);
+	TEST_CHECK(stats.vertexNum == vertexNum);
+	TEST_CHECK(stats.maxBoneNum == maxBoneNum);
+	TEST_CHECK_NEAR(stats.duplicationRatio, (double)vertexNum / synthetic.mesh.vertexNum, 1e-6);
+	TEST_CHECK(stats.vertexNum >= stats.sourceVertexNum);
+
+	printf("%-22s bones %4u max %3u: partitions %u, max bones %u, vertices %u -> %u (x%.3f)\n",
+		name, synthetic.mesh.boneNum, maxBones, stats.partitionNum, stats.maxBoneNum, stats.sourceVertexNum, stats.vertexNum, stats.duplicationRatio);
+}
+
+int main()
+{
+	// 葫̂悤ȍA300{100{
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 301, 32, 300, false);
+		CheckPartitions("chain 300", synthetic, SKIN_PALETTE_MAX, 3);
+	}
+	// 
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 301, 16, 300, false);
+		CheckPartitions("chain 300, limit 40", synthetic, 40, 8);
+	}
+	// {[΂΂ij
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 40, 40, 150, true);
+		CheckPartitions("random 150", synthetic, SKIN_PALETTE_MAX, 2);
+	}
+
+	// ܂郁bV͕ȂA_Ȃ
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 81, 32, 80, false);
+		CheckPartitions("chain 80 (fits)", synthetic, SKIN_PALETTE_MAX, 1);
+		std::vector<BONE_PARTITION> partitions;
+		PartitionMeshBones(&synthetic.mesh, SKIN_PALETTE_MAX, partitions);
+		BONE_PARTITION_STATS stats = GetBonePartitionStats(&synthetic.mesh, partitions);
+		TEST_CHECK(stats.partitionNum == 1);
+		TEST_CHECK(stats.vertexNum == stats.sourceVertexNum);
+	}
+
+	// d0̉e̓{[ƂĐA̔ԍ0
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 21, 8, 20, false);
+		for (VERTEX_BONE_WEIGHT& boneWeight : synthetic.boneWeights) {
+			boneWeight.boneIndexes[3] = 19;
+			boneWeight.weights[3] = 0.0f;
+		}
+		std::vector<BONE_PARTITION> partitions;
+		TEST_CHECK(PartitionMeshBones(&synthetic.mesh, 100, partitions));
+		for (const BONE_PARTITION& partition : partitions) {
+			for (const VERTEX_BONE_WEIGHT& boneWeight : partition.boneWeights) {
+				TEST_CHECK(boneWeight.boneIndexes[3] == 0);
+			}
+		}
+	}
+
+	// ȂF̎Op`ŏ𒴂AOp`ȊO
+	{
+		SYNTHETIC_MESH synthetic;
+		CreateCylinder(synthetic, 10, 10, 50, true);
+		std::vector<BONE_PARTITION> partitions;
+		TEST_CHECK(!PartitionMeshBones(&synthetic.mesh, 4, partitions));
+		TEST_CHECK(partitions.empty());
+		synthetic.mesh.primitiveType = PRIMITIVE_TYPE_LINE;
+		TEST_CHECK(!PartitionMeshBones(&synthetic.mesh, SKIN_PALETTE_MAX, partitions));
+	}
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,160 @@
+// =======================================================
+// dualQuaternionSkinningTest.cpp
+//
+// fANH[^jIXLjÕeXg
+// Ee{̒_͍s̐`uhƈv邱ƁiʒuƖ@j
+// E{̃{[50/50ɂ˂ĂA˂ꎲ̔aۂ邱
+//   i`uh180x߂ŒׂALfBbp[j
+// E[gɈlȊgkĂAspaceɃ[g̃[hsnΐ`uhƈv邱
+//   ispacePʍsȂgkĈvȂj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "skinning.h"
+#include <random>
+
+using namespace MG;
+
+// Sm[h{[ɂāAbindPose̋tsItZbgɂiskinPaletteTestƓj
+static std::vector<MESH_BONE> MakeBones(const Model* model, const Pose& bindPose)
+{
+	const unsigned int boneNum = std::min(model->nodeNum, SKIN_PALETTE_MAX);
+	std::vector<MESH_BONE> bones(boneNum);
+	for (unsigned int b = 0; b < boneNum; b++) {
+		bones[b] = { bindPose.GetWorld(b).Inverse(), model->rawModel->rootNode + b };
+	}
+	return bones;
+}
+
+// _ƂɈ{̃{[
+static void MakeSingleInfluenceVertices(unsigned int boneNum, std::vector<VERTEX>& vertices, std::vector<VERTEX_BONE_WEIGHT>& boneWeights)
+{
+	std::mt19937 random(3);
+	std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+	const unsigned int vertexNum = boneNum * 8;
+	vertices.resize(vertexNum);
+	boneWeights.resize(vertexNum);
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		vertices[v] = {};
+		vertices[v].position = { range(random), range(random), range(random) };
+		vertices[v].normal = Normalize(F3{ range(random), range(random), range(random) + 0.01f });
+		boneWeights[v] = {};
+		boneWeights[v].boneIndexes[0] = v % boneNum;
+		boneWeights[v].weights[0] = 1.0f;
+	}
+}
+
+struct SKIN_ERROR {
+	float position;
+	float normal;
+};
+
+// p`uhƃfANH[^jIŃXLjOčԂ
+static SKIN_ERROR CompareWithLinear(const Model* model, const Pose& pose, const std::vector<MESH_BONE>& bones, const M3x4& space)
+{
+	unsigned int boneNum = (unsigned int)bones.size();
+	std::vector<VERTEX> vertices;
+	std::vector<VERTEX_BONE_WEIGHT> boneWeights;
+	MakeSingleInfluenceVertices(boneNum, vertices, boneWeights);
+	unsigned int vertexNum = (unsigned int)vertices.size();
+
+	std::vector<M3x4> palette(boneNum);
+	std::vector<DUAL_QUATERNION> dqPalette(boneNum);
+	BuildSkinPalette(model, pose, bones.data(), boneNum, palette.data());
+	BuildDualQuaternionPalette(model, pose, bones.data(), boneNum, space, dqPalette.data());
+
+	std::vector<F3> linearPositions(vertexNum), linearNormals(vertexNum);
+	std::vector<F3> dqPositions(vertexNum), dqNormals(vertexNum);
+	SkinVertices(vertices.data(), boneWeights.data(), vertexNum, palette.data(), linearPositions.data(), linearNormals.data());
+	SkinVerticesDualQuaternion(vertices.data(), boneWeights.data(), vertexNum, dqPalette.data(), space, dqPositions.data(), dqNormals.data());
+
+	SKIN_ERROR error = {};
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		error.position = std::max(error.position, Distance(dqPositions[v], linearPositions[v]));
+		error.normal = std::max(error.normal, Distance(dqNormals[v], linearNormals[v]));
+	}
+	return error;
+}
+
+// bone0͓Abone1Xangle˂āAX甼a1̓_50/50ō
+static void CheckTwist()
+{
+	DUAL_QUATERNION palette[2] = {
+		DualQuaternionFromMatrix(M3x4::Identity()),
+		{},
+	};
+	VERTEX vertex = {};
+	vertex.position = { 0.3f, 1.0f, 0.0f };
+	vertex.normal = { 0.0f, 1.0f, 0.0f };
+	VERTEX_BONE_WEIGHT boneWeight = {};
+	boneWeight.boneIndexes[1] = 1;
+	boneWeight.weights[0] = 0.5f;
+	boneWeight.weights[1] = 0.5f;
+
+	float maxRadiusError = 0.0f;
+	float maxAngleError = 0.0f;
+	float minLinearRadius = 1.0f;
+	for (int degree = 0; degree <= 170; degree += 10) {
+		float angle = degree * PI / 180.0f;
+		M3x4 twist = M3x4::FromTRS({ 1.0f, 1.0f, 1.0f }, Quaternion::AxisXRadian(angle), { 0.0f, 0.0f, 0.0f });
+		palette[1] = DualQuaternionFromMatrix(twist);
+		M3x4 linearPalette[2] = { M3x4::Identity(), twist };
+
+		F3 position, normal, linearPosition;
+		SkinVerticesDualQuaternion(&vertex, &boneWeight, 1, palette, M3x4::Identity(), &position, &normal);
+		SkinVertices(&vertex, &boneWeight, 1, linearPalette, &linearPosition, nullptr);
+
+		// a1̂܂܁Apx͂傤ǔA͂̂܂
+		float radius = sqrtf(position.y * position.y + position.z * position.z);
+		float halfAngle = fabsf(atan2f(position.z, position.y));
+		maxRadiusError = std::max(maxRadiusError, fabsf(radius - 1.0f));
+		maxAngleError = std::max(maxAngleError, fabsf(halfAngle - angle * 0.5f));
+		TEST_CHECK_NEAR(position.x, 0.3f, 1e-5f);
+		TEST_CHECK_NEAR(Distance(normal, F3{}), 1.0f, 1e-5f);
+		minLinearRadius = std::min(minLinearRadius, sqrtf(linearPosition.y * linearPosition.y + linearPosition.z * linearPosition.z));
+	}
+	TEST_CHECK(maxRadiusError < 1e-5f);
+	TEST_CHECK(maxAngleError < 1e-4f);
+	TEST_CHECK(minLinearRadius < 0.1f);	// ׂ鑊̐`uh170xłقڒׂ
+	printf("twist 0-170 deg: radius error %g, angle error %g (linear blend radius down to %g)\n", maxRadiusError, maxAngleError, minLinearRadius);
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	AnimationCursor cursor;
+	std::vector<ANIMATION_APPLICANT> applicants{ { walk, 7.0f, &cursor, &binding } };
+
+	Pose bindPose;
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({ 1.0f, 0.5f, -2.0f }), bindPose);
+	std::vector<MESH_BONE> bones = MakeBones(model, bindPose);
+	TEST_CHECK(bones.size() > 1);
+
+	// {̉eFgk̂Ȃp
+	Pose pose;
+	LoadNodeWorldTransforms(model, M4x4::FromTRS({ 1.0f, 1.0f, 1.0f }, Quaternion::AxisYDegree(30.0f), { -0.5f, 0.2f, 1.0f }), pose, applicants);
+	SKIN_ERROR rigid = CompareWithLinear(model, pose, bones, M3x4::Identity());
+	TEST_CHECK(rigid.position < 1e-4f);
+	TEST_CHECK(rigid.normal < 1e-4f);
+
+	// [g̈lȊgkspaceŋ
+	Pose scaledPose;
+	LoadNodeWorldTransforms(model, M4x4::FromTRS({ 2.0f, 2.0f, 2.0f }, Quaternion::AxisYDegree(30.0f), { -0.5f, 0.2f, 1.0f }), scaledPose, applicants);
+	SKIN_ERROR scaled = CompareWithLinear(model, scaledPose, bones, scaledPose.GetWorld(0));
+	TEST_CHECK(scaled.position < 1e-4f);
+	TEST_CHECK(scaled.normal < 1e-4f);
+	SKIN_ERROR unscaled = CompareWithLinear(model, scaledPose, bones, M3x4::Identity());
+	TEST_CHECK(unscaled.position > 0.1f);
+
+	printf("single influence: position error %g, normal error %g\n", rigid.position, rigid.normal);
+	printf("root scale 2 with space: position error %g, normal error %g (identity space %g)\n", scaled.position, scaled.normal, unscaled.position);
+
+	CheckTwist();
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
@@ -0,0 +1,93 @@
+// =======================================================
+// inertializationTest.cpp
+//
+// Ԃ̌Ȑ̃eXg
+// Jڐ֌xAs߂ɒP0܂Ō邱
+// ixa0 > 0ɂȂꍇFx0 = 0.3Av0 = -0.004/msA300msj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "inertialization.h"
+
+using namespace MG;
+
+static void ResetPose(Pose& pose, unsigned int nodeNum)
+{
+	pose.Resize(nodeNum);
+	NODE_TRANSFORM* locals = pose.GetLocals();
+	for (unsigned int i = 0; i < nodeNum; i++) {
+		locals[i].scale = { 1.0f, 1.0f, 1.0f };
+		locals[i].rotate = Quaternion::Identity();
+		locals[i].position = { 0.0f, 0.0f, 0.0f };
+	}
+}
+
+// ̃m[hposition.xđJڂAet[̒lԂ
+static std::vector<float> EvaluateOffsets(const Model* model, float x0, float v0, float duration, float deltaTime)
+{
+	Pose source, previousSource, destination;
+	ResetPose(source, model->nodeNum);
+	ResetPose(previousSource, model->nodeNum);
+	ResetPose(destination, model->nodeNum);
+	source.GetLocals()[0].position.x = x0;
+	previousSource.GetLocals()[0].position.x = x0 - v0 * deltaTime;
+
+	Inertialization inertialization(duration);
+	inertialization.Start(model, source, previousSource, deltaTime, destination);
+	std::vector<float> values;
+	while (!inertialization.IsFinished()) {
+		Pose pose = destination;
+		inertialization.Apply(model, pose, deltaTime);
+		values.push_back(pose.GetLocals()[0].position.x);
+	}
+	return values;
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	TEST_CHECK(model->nodeNum > 0);
+
+	const float deltaTime = 1.0f;
+	const float x0s[] = { 0.3f, 0.3f, 0.3f, 1.0f };
+	const float v0s[] = { -0.004f, -0.001f, 0.0f, -0.02f };
+	for (int c = 0; c < 4; c++) {
+		std::vector<float> values = EvaluateOffsets(model, x0s[c], v0s[c], 300.0f, deltaTime);
+		TEST_CHECK(!values.empty());
+		if (values.empty()) {
+			continue;
+		}
+		TEST_CHECK_NEAR(values.front(), x0s[c], 1e-5);
+
+		// PŁAJڐzȂ
+		float minValue = values.front();
+		float maxIncrease = 0.0f;
+		for (size_t i = 1; i < values.size(); i++) {
+			maxIncrease = std::max(maxIncrease, values[i] - values[i - 1]);
+			minValue = std::min(minValue, values[i]);
+		}
+		TEST_CHECK(maxIncrease <= 1e-6f);
+		TEST_CHECK(minValue >= -1e-5f);
+		TEST_CHECK_NEAR(values.back(), 0.0f, 1e-4);
+		printf("x0 %.2f v0 %.4f/ms: frames %u, last %g, min %g, max increase %g\n",
+			x0s[c], v0s[c], (unsigned int)values.size(), values.back(), minValue, maxIncrease);
+	}
+
+	// m[h̍Ȃpɂ͍𑫂Ȃ
+	{
+		Pose source, previousSource, destination, pose;
+		ResetPose(source, model->nodeNum);
+		ResetPose(previousSource, model->nodeNum);
+		ResetPose(destination, model->nodeNum);
+		source.GetLocals()[0].position.x = 0.3f;
+		Inertialization inertialization(300.0f);
+		inertialization.Start(model, source, previousSource, deltaTime, destination);
+		ResetPose(pose, 1);
+		inertialization.Apply(model, pose, deltaTime);
+		TEST_CHECK(pose.GetLocals()[0].position.x == 0.0f);
+	}
+
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
@@ -0,0 +1,124 @@
+// =======================================================
+// poseBlendTest.cpp
+//
+// BlendPoses̃eXg
+// SIMDob`ł̎p̕ԂAm[hƂ̃XJ[
+// iLerpABlendQuaternionjƃJ[ľ덷͈̔͂ňv邱
+// SĂ̖߃ZbgƉ]̕ԕ@Ŋm߂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "pose.h"
+#include "animationKernel.h"
+#include <cstring>
+#include <random>
+
+using namespace MG;
+
+static float GetMaxDifference(const Pose& pose, const std::vector<NODE_TRANSFORM>& expected)
+{
+	float difference = 0.0f;
+	const NODE_TRANSFORM* locals = pose.GetLocals();
+	for (size_t i = 0; i < expected.size(); i++) {
+		const float* a = (const float*)&locals[i];
+		const float* b = (const float*)&expected[i];
+		for (size_t e = 0; e < sizeof(NODE_TRANSFORM) / sizeof(float); e++) {
+			difference = std::max(difference, fabsf(a[e] - b[e]));
+		}
+	}
+	return difference;
+}
+
+int main()
+{
+	// ׂȎpim[hSIMD̕Ŋ؂Ȃj
+	const unsigned int nodeNum = 1003;
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> range(-1.0f, 1.0f);
+	Pose pose0(nodeNum), pose1(nodeNum);
+	for (Pose* pose : { &pose0, &pose1 }) {
+		NODE_TRANSFORM* locals = pose->GetLocals();
+		for (unsigned int i = 0; i < nodeNum; i++) {
+			locals[i].scale = { 1.0f + range(random) * 0.5f, 1.0f + range(random) * 0.5f, 1.0f + range(random) * 0.5f };
+			locals[i].position = { range(random) * 10.0f, range(random) * 10.0f, range(random) * 10.0f };
+			locals[i].rotate = Quaternion::AxisRadian(Normalize(F3{ range(random), range(random), range(random) + 0.01f }), range(random) * PI);
+		}
+	}
+	// t̔A]
+	pose1.GetLocals()[1].rotate = { -pose0.GetLocals()[1].rotate.x, -pose0.GetLocals()[1].rotate.y, -pose0.GetLocals()[1].rotate.z, -pose0.GetLocals()[1].rotate.w };
+	pose1.GetLocals()[2].rotate = pose0.GetLocals()[2].rotate;
+
+	const char* kernelNames[] = { "scalar", "SSE", "AVX2" };
+	const QUATERNION_BLEND_MODE modes[] = { QUATERNION_BLEND_NLERP, QUATERNION_BLEND_FAST_SLERP, QUATERNION_BLEND_SLERP };
+	const char* modeNames[] = { "nlerp", "fast slerp", "slerp" };
+	const float modeEpsilons[] = { ANIMATION_KERNEL_NLERP_EPSILON, ANIMATION_KERNEL_FAST_SLERP_EPSILON, ANIMATION_KERNEL_SLERP_EPSILON };
+	const QUATERNION_BLEND_MODE blendMode = GetQuaternionBlendMode();
+	const ANIMATION_KERNEL kernel = GetAnimationKernel();
+
+	std::vector<NODE_TRANSFORM> expected(nodeNum);
+	for (int k = 0; k <= (int)GetSupportedAnimationKernel(); k++) {
+		SetAnimationKernel((ANIMATION_KERNEL)k);
+		for (int m = 0; m < 3; m++) {
+			SetQuaternionBlendMode(modes[m]);
+			for (float t : { 0.0f, 0.3f, 1.0f }) {
+				for (unsigned int i = 0; i < nodeNum; i++) {
+					const NODE_TRANSFORM& a = pose0.GetLocals()[i];
+					const NODE_TRANSFORM& b = pose1.GetLocals()[i];
+					expected[i] = { Lerp(a.scale, b.scale, t), BlendQuaternion(a.rotate, b.rotate, t), Lerp(a.position, b.position, t) };
+				}
+				Pose out;
+				BlendPoses(pose0, pose1, t, out);
+				TEST_CHECK(out.GetNodeNum() == nodeNum);
+				float difference = GetMaxDifference(out, expected);
+				// ʒu͑傫10܂
+				TEST_CHECK(difference <= std::max(modeEpsilons[m], ANIMATION_KERNEL_LERP_EPSILON * 10.0f));
+				if (t == 0.3f) {
+					printf("%-6s %-10s: max difference %g\n", kernelNames[k], modeNames[m], difference);
+				}
+			}
+		}
+	}
+
+	// o͂͂ƓpɂĂ
+	{
+		SetAnimationKernel(GetSupportedAnimationKernel());
+		SetQuaternionBlendMode(QUATERNION_BLEND_NLERP);
+		Pose expectedPose;
+		BlendPoses(pose0, pose1, 0.7f, expectedPose);
+		Pose inPlace = pose0;
+		BlendPoses(inPlace, pose1, 0.7f, inPlace);
+		TEST_CHECK(memcmp(inPlace.GetLocals(), expectedPose.GetLocals(), sizeof(NODE_TRANSFORM) * nodeNum) == 0);
+	}
+
+	// Jځi̃Aj[VZbgj͂ꂼ̕]Ԃ
+	{
+		Model* model = LoadTestModel("kumacchi.mgm");
+		Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+		Animation* swing = LoadTestAnimation("kumacchi_swing_down.mga");
+		AnimationCursor walkCursor, swingCursor;
+		std::vector<ANIMATION_APPLICANT> set0{ { walk, 5.0f, &walkCursor } };
+		std::vector<ANIMATION_APPLICANT> set1{ { swing, 3.0f, &swingCursor } };
+		Pose walkPose, swingPose, transition;
+		LoadNodeLocalTransforms(model, walkPose, set0);
+		LoadNodeLocalTransforms(model, swingPose, set1);
+		LoadNodeLocalTransforms(model, transition, set0, set1, 0.4f);
+		std::vector<NODE_TRANSFORM> expectedTransition(model->nodeNum);
+		for (unsigned int i = 0; i < model->nodeNum; i++) {
+			const NODE_TRANSFORM& a = walkPose.GetLocals()[i];
+			const NODE_TRANSFORM& b = swingPose.GetLocals()[i];
+			expectedTransition[i] = { Lerp(a.scale, b.scale, 0.4f), BlendQuaternion(a.rotate, b.rotate, 0.4f), Lerp(a.position, b.position, 0.4f) };
+		}
+		TEST_CHECK(transition.GetNodeNum() == model->nodeNum);
+		float difference = GetMaxDifference(transition, expectedTransition);
+		TEST_CHECK(difference <= 1e-4f);
+		printf("kumacchi walk -> swing_down: max difference %g\n", difference);
+		ReleaseTestAnimation(swing);
+		ReleaseTestAnimation(walk);
+		ReleaseTestModel(model);
+	}
+
+	SetAnimationKernel(kernel);
+	SetQuaternionBlendMode(blendMode);
+	return TEST_RESULT();
+}
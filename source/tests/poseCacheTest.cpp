@@ -0,0 +1,163 @@
+// =======================================================
+// poseCacheTest.cpp
+//
+// LpLbṼeXg
+// EframeStep 0ȂAʂCrowdEvaluatořʂƃrbgPʂňv邱Ɓi[Jϊƃ[hsj
+// EframeStep NȂAframeStep / 2t[ȓ̗ʎqt[̎pƈv邱
+// E}XNtAANIMATION_APPLICANTAcoastAupdateMask̃Wu̓LbVʂ炸A
+//   ʂ̕]ƓʂɂȂ邱
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "poseCache.h"
+#include <random>
+#include <string.h>
+
+using namespace MG;
+
+struct CROWD {
+	std::vector<std::vector<ANIMATION_APPLICANT>> applicants;
+	std::vector<Pose> poses;
+	std::vector<CROWD_JOB> jobs;
+};
+
+// t[̂ŋL悤ɁAframeNumނ̃t[jobNum̂ɔz
+static void MakeCrowd(const Model* model, Animation* animation, const AnimationBinding& binding,
+	size_t jobNum, unsigned int frameNum, CROWD& crowd)
+{
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> frameRange(0.0f, animation->rawAnimation->frames);
+	std::vector<float> frames(frameNum);
+	for (float& frame : frames) {
+		frame = frameRange(random);
+	}
+	crowd.applicants.clear();
+	crowd.poses.assign(jobNum, Pose());
+	crowd.jobs.clear();
+	for (size_t i = 0; i < jobNum; i++) {
+		crowd.applicants.push_back({ { animation, frames[i % frameNum], nullptr, &binding } });
+	}
+	for (size_t i = 0; i < jobNum; i++) {
+		M4x4 world = M4x4::TranslatingMatrix({ (float)(i % 8), 0.0f, (float)(i / 8) });
+		crowd.jobs.push_back({ model, &crowd.applicants[i], world, &crowd.poses[i] });
+	}
+}
+
+static bool SamePose(const Pose& a, const Pose& b, unsigned int nodeNum)
+{
+	return memcmp(a.GetLocals(), b.GetLocals(), sizeof(NODE_TRANSFORM) * nodeNum) == 0
+		&& memcmp(a.GetWorlds(), b.GetWorlds(), sizeof(M3x4) * nodeNum) == 0;
+}
+
+static void CheckStepZero(const Model* model, Animation* animation, const AnimationBinding& binding, CrowdEvaluator& evaluator)
+{
+	CROWD plain, cached;
+	MakeCrowd(model, animation, binding, 64, 10, plain);
+	MakeCrowd(model, animation, binding, 64, 10, cached);
+
+	PoseCache cache;
+	cache.SetFrameStep(0.0f);
+	evaluator.Evaluate(plain.jobs);
+	cache.Evaluate(evaluator, cached.jobs);
+
+	unsigned int sameNum = 0;
+	for (size_t i = 0; i < plain.jobs.size(); i++) {
+		TEST_CHECK(cached.jobs[i].sharedPose != nullptr);
+		sameNum += SamePose(plain.poses[i], cached.poses[i], model->nodeNum) ? 1 : 0;
+	}
+	TEST_CHECK(sameNum == plain.jobs.size());
+	const POSE_CACHE_STATS& stats = cache.GetStats();
+	TEST_CHECK(stats.lookupNum == 64);
+	TEST_CHECK(stats.entryNum == 10);
+	TEST_CHECK(stats.hitNum == 54);
+	printf("step 0: %u/%zu poses bit-identical, %u entries, hit rate %.2f\n", sameNum, plain.jobs.size(), stats.entryNum, stats.hitRate);
+}
+
+static void CheckStep(const Model* model, Animation* animation, const AnimationBinding& binding, CrowdEvaluator& evaluator, float step)
+{
+	CROWD cached;
+	MakeCrowd(model, animation, binding, 64, 64, cached);
+	PoseCache cache;
+	cache.SetFrameStep(step);
+	cache.Evaluate(evaluator, cached.jobs);
+
+	// ʎqt[ŕʂɕ]̂ƈvÃt[step / 2ȓ
+	float maxFrameError = 0.0f;
+	unsigned int sameNum = 0;
+	for (size_t i = 0; i < cached.jobs.size(); i++) {
+		float frame = cached.applicants[i][0].currentFrame;
+		float quantized = floorf(frame / step + 0.5f) * step;
+		maxFrameError = std::max(maxFrameError, fabsf(quantized - frame));
+
+		std::vector<ANIMATION_APPLICANT> reference{ { animation, quantized, nullptr, &binding } };
+		Pose expected;
+		CROWD_JOB job = { model, &reference, cached.jobs[i].worldTransform, &expected };
+		evaluator.Evaluate(&job, 1);
+		sameNum += SamePose(expected, cached.poses[i], model->nodeNum) ? 1 : 0;
+	}
+	TEST_CHECK(sameNum == cached.jobs.size());
+	TEST_CHECK(maxFrameError <= step * 0.5f + 1e-4f);
+	TEST_CHECK(cache.GetStats().entryNum <= (unsigned int)(animation->rawAnimation->frames / step) + 2);
+	printf("step %g: %u/%zu poses match the quantized frame, max frame error %g, %u entries\n",
+		step, sameNum, cached.jobs.size(), maxFrameError, cache.GetStats().entryNum);
+}
+
+static void CheckBypass(const Model* model, Animation* animation, const AnimationBinding& binding, CrowdEvaluator& evaluator)
+{
+	BoneMask mask(model->nodeNum);
+	mask.SetBinding(&binding);
+	BoneMask updateMask(model->nodeNum);
+	updateMask.Set(0);
+
+	// 0F}XNtA1FapplicantA2FcoastA3FupdateMaskA4FLbV̑Ώ
+	const size_t jobNum = 5;
+	CROWD plain, cached;
+	for (CROWD* crowd : { &plain, &cached }) {
+		MakeCrowd(model, animation, binding, jobNum, 1, *crowd);
+		// coastupdateMask͑O̎pv̂ŁAႤt[ňx]Ă
+		std::vector<ANIMATION_APPLICANT> previous{ { animation, 1.0f, nullptr, &binding } };
+		for (CROWD_JOB job : crowd->jobs) {
+			job.animationApplicants = &previous;
+			evaluator.Evaluate(&job, 1);
+		}
+		ANIMATION_APPLICANT masked = { animation, crowd->applicants[0][0].currentFrame, nullptr, &binding, 1.0f, &mask };
+		crowd->applicants[0].clear();
+		crowd->applicants[0].push_back(masked);
+		crowd->applicants[1].push_back({ animation, 2.0f, nullptr, &binding, 0.5f });
+		crowd->jobs[2].coast = true;
+		crowd->jobs[3].updateMask = &updateMask;
+	}
+
+	PoseCache cache;
+	cache.SetFrameStep(4.0f);
+	evaluator.Evaluate(plain.jobs);
+	cache.Evaluate(evaluator, cached.jobs);
+
+	for (size_t i = 0; i < jobNum; i++) {
+		bool expectShared = i == 4;
+		TEST_CHECK((cached.jobs[i].sharedPose != nullptr) == expectShared);
+		if (!expectShared) {
+			TEST_CHECK(SamePose(plain.poses[i], cached.poses[i], model->nodeNum));
+		}
+	}
+	TEST_CHECK(cache.GetStats().lookupNum == 1);
+	TEST_CHECK(cache.GetStats().entryNum == 1);
+}
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	CrowdEvaluator evaluator(4);
+
+	CheckStepZero(model, walk, binding, evaluator);
+	CheckStep(model, walk, binding, evaluator, 1.0f);
+	CheckStep(model, walk, binding, evaluator, 4.0f);
+	CheckBypass(model, walk, binding, evaluator);
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
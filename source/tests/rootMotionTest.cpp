@@ -0,0 +1,89 @@
+// =======================================================
+// rootMotionTest.cpp
+//
+// [g[ṼeXgi͌̕_ő݂̂ŁAAj[Vgj
+// ̑őOɐi݂Ȃ̊ŋȂi~ʁj[gm[hȂA
+// ǂn߂Ăt[͓̍ɂȂ
+// E[v̏I[܂A܂Ȃ̍ƈv邱
+// E܂łA蒷~ʂ̎ƈv邱
+// E[vȂΏI[Ŏ~܂邱
+// EoƂ̃L[͐ړƃ[ȂȂA㉺ړ͎c邱
+// Eoς݂̃Aj[V́AႤm[hł͔oȂ
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+
+using namespace MG;
+
+static constexpr unsigned int FRAME_NUM = 30;
+static constexpr float SPEED = 0.02f;		// 1t[ɐiދ
+static constexpr float TURN = 0.03f;		// 1t[ɋȂpxiWAj
+
+// 0n߂framesi񂾂Ƃ̍i̎_̌j
+static ROOT_MOTION_DELTA ExpectedDelta(float frames)
+{
+	float yaw = TURN * frames;
+	return { { SPEED / TURN * (1.0f - cosf(yaw)), 0.0f, SPEED / TURN * sinf(yaw) }, yaw };
+}
+
+static void CheckDelta(const ROOT_MOTION_DELTA& delta, const ROOT_MOTION_DELTA& expected, const char* name)
+{
+	TEST_CHECK_NEAR(delta.position.x, expected.position.x, 1e-4f);
+	TEST_CHECK_NEAR(delta.position.y, expected.position.y, 1e-4f);
+	TEST_CHECK_NEAR(delta.position.z, expected.position.z, 1e-4f);
+	TEST_CHECK_NEAR(delta.yaw, expected.yaw, 1e-4f);
+	printf("%-28s position (%.4f, %.4f, %.4f) yaw %.4f\n", name, delta.position.x, delta.position.y, delta.position.z, delta.yaw);
+}
+
+int main()
+{
+	// t[Ƃ̃L[i㉺ɗhȂ~ʂiށj
+	std::vector<VECTOR_KEY> positionKeys(FRAME_NUM + 1);
+	std::vector<QUATERNION_KEY> rotationKeys(FRAME_NUM + 1);
+	for (unsigned int f = 0; f <= FRAME_NUM; f++) {
+		ROOT_MOTION_DELTA pose = ExpectedDelta((float)f);
+		positionKeys[f] = { (float)f, { pose.position.x, 0.05f * sinf((float)f), pose.position.z } };
+		rotationKeys[f] = { (float)f, Quaternion::AxisYRadian(pose.yaw) };
+	}
+	ANIMATION_CHANNEL channel = { FRAME_NUM + 1, 0, FRAME_NUM + 1, positionKeys.data(), nullptr, rotationKeys.data(), "root" };
+	ANIMATION raw = { 30.0f, (float)FRAME_NUM, 1, &channel, "arc" };
+	Animation animation(0);
+	animation.rawAnimation = &raw;
+	animation.modelNodeChannels["root"] = &channel;
+
+	TEST_CHECK(animation.GetRootMotionDelta(0.0f, 10.0f).yaw == 0.0f);
+	TEST_CHECK(animation.ExtractRootMotion("root"));
+	TEST_CHECK(animation.HasRootMotion());
+	TEST_CHECK(animation.ExtractRootMotion("root"));
+	TEST_CHECK(!animation.ExtractRootMotion("other"));
+
+	// L[Ɏĉ͏㉺ړ
+	float horizontal = 0.0f, twist = 0.0f;
+	for (unsigned int f = 0; f <= FRAME_NUM; f++) {
+		horizontal = std::max(horizontal, fabsf(positionKeys[f].vector.x) + fabsf(positionKeys[f].vector.z));
+		twist = std::max(twist, fabsf(rotationKeys[f].rotate.y));
+		TEST_CHECK_NEAR(positionKeys[f].vector.y, 0.05f * sinf((float)f), 1e-6f);
+	}
+	TEST_CHECK(horizontal < 1e-6f);
+	TEST_CHECK(twist < 1e-6f);
+
+	const float frames = (float)FRAME_NUM;
+	CheckDelta(animation.GetRootMotionDelta(5.0f, 15.0f), ExpectedDelta(10.0f), "5 -> 15");
+	CheckDelta(animation.GetRootMotionDelta(25.0f, 5.0f), ExpectedDelta(10.0f), "25 -> 5 (wrap)");
+	CheckDelta(animation.GetRootMotionDelta(29.0f, 1.0f), ExpectedDelta(2.0f), "29 -> 1 (wrap)");
+	CheckDelta(animation.GetRootMotionDelta(10.0f, 10.0f + frames * 2.0f), ExpectedDelta(frames * 2.0f), "10 -> 70 (two loops)");
+	CheckDelta(animation.GetRootMotionDelta(0.0f, frames), ExpectedDelta(frames), "0 -> 30 (one loop)");
+	CheckDelta(animation.GetRootMotionDelta(25.0f, 40.0f, false), ExpectedDelta(5.0f), "25 -> 40 (no loop, clamped)");
+
+	// I[܂łAɕđ̂Ɠit[͐łȂĂj
+	ROOT_MOTION_DELTA whole = animation.GetRootMotionDelta(27.5f, 3.25f);
+	ROOT_MOTION_DELTA first = animation.GetRootMotionDelta(27.5f, frames, false);
+	ROOT_MOTION_DELTA second = animation.GetRootMotionDelta(0.0f, 3.25f, false);
+	F3 joined = first.position + Rotate(second.position, Quaternion::AxisYRadian(first.yaw));
+	TEST_CHECK_NEAR(whole.position.x, joined.x, 1e-5f);
+	TEST_CHECK_NEAR(whole.position.z, joined.z, 1e-5f);
+	TEST_CHECK_NEAR(whole.yaw, first.yaw + second.yaw, 1e-5f);
+
+	return TEST_RESULT();
+}
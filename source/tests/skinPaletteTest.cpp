@@ -0,0 +1,104 @@
+// =======================================================
+// skinPaletteTest.cpp
+//
+// BuildSkinPalettẽeXg
+// pbgňϊʂAItZbgs񁨃[hs̓ϊƈv邱
+// kumacchĩbV̓XLȂȂ̂ŁASm[h{[ƂĎg
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "skinning.h"
+#include <random>
+
+using namespace MG;
+
+int main()
+{
+	Model* model = LoadTestModel("kumacchi.mgm");
+	Animation* walk = LoadTestAnimation("kumacchi_walk.mga");
+	AnimationBinding binding(model, walk);
+	AnimationCursor cursor;
+	std::vector<ANIMATION_APPLICANT> applicants{ { walk, 7.0f, &cursor, &binding } };
+
+	Pose bindPose, pose;
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({ 1.0f, 0.5f, -2.0f }), bindPose);
+	LoadNodeWorldTransforms(model, M4x4::TranslatingMatrix({ 1.0f, 0.5f, -2.0f }), pose, applicants);
+
+	// {[̓m[h̋tipbg̔ԍƃm[hԍႤƁj
+	const unsigned int boneNum = std::min(model->nodeNum, SKIN_PALETTE_MAX);
+	std::vector<MESH_BONE> bones(boneNum);
+	for (unsigned int b = 0; b < boneNum; b++) {
+		unsigned int nodeIndex = model->nodeNum - 1 - b;
+		bones[b] = { bindPose.GetWorld(nodeIndex).Inverse(), model->rawModel->rootNode + nodeIndex };
+	}
+	TEST_CHECK(boneNum > 1);
+
+	std::vector<M3x4> palette(boneNum);
+
+	// oCh|[YȂPʍs
+	BuildSkinPalette(model, bindPose, bones.data(), boneNum, palette.data());
+	const M3x4 identityMatrix = M3x4::Identity();
+	const float* identity = &identityMatrix._v00;
+	float identityError = 0.0f;
+	for (unsigned int b = 0; b < boneNum; b++) {
+		const float* m = &palette[b]._v00;
+		for (int e = 0; e < 12; e++) {
+			identityError = std::max(identityError, fabsf(m[e] - identity[e]));
+		}
+	}
+	TEST_CHECK(identityError < 1e-4f);
+
+	// _ƂɃItZbg[h̓ϊƔׂ
+	BuildSkinPalette(model, pose, bones.data(), boneNum, palette.data());
+	std::mt19937 random(5);
+	std::uniform_real_distribution<float> range(-2.0f, 2.0f);
+	float pointError = 0.0f;
+	for (unsigned int b = 0; b < boneNum; b++) {
+		const M3x4& world = pose.GetWorld(model->GetNodeIndex(bones[b].node));
+		for (int i = 0; i < 8; i++) {
+			F3 point = { range(random), range(random), range(random) };
+			pointError = std::max(pointError, Distance(palette[b] * point, world * (bones[b].offset * point)));
+		}
+	}
+	TEST_CHECK(pointError < 1e-4f);
+
+	// 4ẽXLjOʂ
+	const unsigned int vertexNum = 1000;
+	std::vector<VERTEX> vertices(vertexNum);
+	std::vector<VERTEX_BONE_WEIGHT> boneWeights(vertexNum);
+	std::uniform_real_distribution<float> weightRange(0.0f, 1.0f);
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		vertices[v] = {};
+		vertices[v].position = { range(random), range(random), range(random) };
+		vertices[v].normal = Normalize(F3{ range(random), range(random), range(random) + 0.01f });
+		float sum = 0.0f;
+		for (int k = 0; k < 4; k++) {
+			boneWeights[v].boneIndexes[k] = random() % boneNum;
+			boneWeights[v].weights[k] = weightRange(random);
+			sum += boneWeights[v].weights[k];
+		}
+		for (int k = 0; k < 4; k++) {
+			boneWeights[v].weights[k] /= sum;
+		}
+	}
+	std::vector<F3> positions(vertexNum), normals(vertexNum);
+	SkinVertices(vertices.data(), boneWeights.data(), vertexNum, palette.data(), positions.data(), normals.data());
+	float skinError = 0.0f;
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		F3 expected = {};
+		for (int k = 0; k < 4; k++) {
+			const MESH_BONE& bone = bones[boneWeights[v].boneIndexes[k]];
+			const M3x4& world = pose.GetWorld(model->GetNodeIndex(bone.node));
+			expected += (world * (bone.offset * vertices[v].position)) * boneWeights[v].weights[k];
+		}
+		skinError = std::max(skinError, Distance(positions[v], expected));
+	}
+	TEST_CHECK(skinError < 1e-4f);
+
+	printf("bones %u: bind identity error %g, point error %g, skinned vertex error %g\n", boneNum, identityError, pointError, skinError);
+
+	ReleaseTestAnimation(walk);
+	ReleaseTestModel(model);
+	return TEST_RESULT();
+}
@@ -0,0 +1,120 @@
+// =======================================================
+// skinningKernelTest.cpp
+//
+// CPUXLjO̖߃Zbgʂ̃eXg
+// ESSEAAVX2SkinVerticesXJ[łƈv邱ƁiʒuƖ@A@Ȃj
+//   _͊ɂAVX2̒[iSSEŏjʂ
+// ESkinningEvaluatoriChunkedJobPoolǰʂXbhSkinVerticesƃrbgPʂňv邱
+// ΉĂȂ߃Zbg͔΂
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#include "testCommon.h"
+#include "skinning.h"
+#include "animationKernel.h"
+#include <random>
+#include <string.h>
+
+using namespace MG;
+
+static const char* KERNEL_NAMES[] = { "scalar", "SSE", "AVX2" };
+
+struct SKIN_INPUT {
+	std::vector<M3x4> palette;
+	std::vector<VERTEX> vertices;
+	std::vector<VERTEX_BONE_WEIGHT> boneWeights;
+};
+
+// gkAf܂ޔCӂ̃AtBsƁA4e̒_
+static SKIN_INPUT MakeInput(unsigned int boneNum, unsigned int vertexNum)
+{
+	SKIN_INPUT input;
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> range(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> weightRange(0.0f, 1.0f);
+
+	input.palette.resize(boneNum);
+	for (M3x4& bone : input.palette) {
+		float* m = &bone._v00;
+		for (int e = 0; e < 12; e++) {
+			m[e] = range(random);
+		}
+	}
+
+	input.vertices.resize(vertexNum);
+	input.boneWeights.resize(vertexNum);
+	for (unsigned int v = 0; v < vertexNum; v++) {
+		input.vertices[v] = {};
+		input.vertices[v].position = { range(random), range(random), range(random) };
+		input.vertices[v].normal = Normalize(F3{ range(random), range(random), range(random) + 0.01f });
+		float sum = 0.0f;
+		for (int k = 0; k < 4; k++) {
+			input.boneWeights[v].boneIndexes[k] = random() % boneNum;
+			input.boneWeights[v].weights[k] = weightRange(random);
+			sum += input.boneWeights[v].weights[k];
+		}
+		for (int k = 0; k < 4; k++) {
+			input.boneWeights[v].weights[k] /= sum;
+		}
+	}
+	return input;
+}
+
+static float MaxDistance(const std::vector<F3>& a, const std::vector<F3>& b)
+{
+	float error = 0.0f;
+	for (size_t i = 0; i < a.size(); i++) {
+		error = std::max(error, Distance(a[i], b[i]));
+	}
+	return error;
+}
+
+int main()
+{
+	const ANIMATION_KERNEL defaultKernel = GetAnimationKernel();
+	const ANIMATION_KERNEL supported = GetSupportedAnimationKernel();
+	const unsigned int vertexNum = 1001;
+	SKIN_INPUT input = MakeInput(40, vertexNum);
+
+	SetAnimationKernel(ANIMATION_KERNEL_SCALAR);
+	std::vector<F3> scalarPositions(vertexNum), scalarNormals(vertexNum);
+	SkinVertices(input.vertices.data(), input.boneWeights.data(), vertexNum, input.palette.data(), scalarPositions.data(), scalarNormals.data());
+
+	for (int kernel = ANIMATION_KERNEL_SCALAR; kernel <= (int)supported; kernel++) {
+		SetAnimationKernel((ANIMATION_KERNEL)kernel);
+		TEST_CHECK(GetAnimationKernel() == (ANIMATION_KERNEL)kernel);
+
+		// XJ[łƔׂ
+		std::vector<F3> positions(vertexNum), normals(vertexNum);
+		SkinVertices(input.vertices.data(), input.boneWeights.data(), vertexNum, input.palette.data(), positions.data(), normals.data());
+		float positionError = MaxDistance(positions, scalarPositions);
+		float normalError = MaxDistance(normals, scalarNormals);
+		TEST_CHECK(positionError < 1e-5f);
+		TEST_CHECK(normalError < 1e-5f);
+
+		// @Ȃłʒu͓
+		std::vector<F3> positionsOnly(vertexNum);
+		SkinVertices(input.vertices.data(), input.boneWeights.data(), vertexNum, input.palette.data(), positionsOnly.data(), nullptr);
+		TEST_CHECK(memcmp(positionsOnly.data(), positions.data(), sizeof(F3) * vertexNum) == 0);
+
+		// s͈XbhƓi̕ŌʂςȂjAɎ܂鐔
+		for (unsigned int threadNum : { 1u, 4u }) {
+			SkinningEvaluator evaluator(threadNum);
+			TEST_CHECK(evaluator.GetThreadNum() == threadNum);
+			for (unsigned int num : { vertexNum, 3u }) {
+				std::vector<F3> parallelPositions(num), parallelNormals(num);
+				evaluator.SkinVertices(input.vertices.data(), input.boneWeights.data(), num, input.palette.data(), parallelPositions.data(), parallelNormals.data());
+				TEST_CHECK(memcmp(parallelPositions.data(), positions.data(), sizeof(F3) * num) == 0);
+				TEST_CHECK(memcmp(parallelNormals.data(), normals.data(), sizeof(F3) * num) == 0);
+			}
+		}
+
+		printf("%-6s: position error %g, normal error %g\n", KERNEL_NAMES[kernel], positionError, normalError);
+	}
+	if (supported == ANIMATION_KERNEL_SCALAR) {
+		printf("SSE/AVX2 not supported, scalar only\n");
+	}
+
+	SetAnimationKernel(defaultKernel);
+	return TEST_RESULT();
+}
@@ -0,0 +1,100 @@
+// =======================================================
+// testCommon.h
+//
+// eXgƃx`}[N̋ʕ
+// ResourceToolDXʂasset/model̃fƃAj[Vǂݍ
+// ieNX`A_obt@͍Ȃj
+//
+// ҁF鰕riKC@}`j@2026/10/17
+// =======================================================
+#ifndef _TEST_COMMON_H
+#define _TEST_COMMON_H
+
+#include "resourceTool.h"
+#include "MGObject.h"
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <chrono>
+
+#ifndef MG_TEST_ASSET_DIR
+#define MG_TEST_ASSET_DIR "../asset/model/"
+#endif
+
+// sꏊ\ĐAmainTEST_RESULT()Ԃ
+inline int g_testFailureNum = 0;
+
+#define TEST_CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			printf("%s(%d): FAILED %s\n", __FILE__, __LINE__, #condition); \
+			g_testFailureNum++; \
+		} \
+	} while (0)
+
+#define TEST_CHECK_NEAR(a, b, epsilon) \
+	do { \
+		double _a = (a), _b = (b); \
+		if (!(fabs(_a - _b) <= (epsilon))) { \
+			printf("%s(%d): FAILED %s = %g, %s = %g (epsilon %g)\n", __FILE__, __LINE__, #a, _a, #b, _b, (double)(epsilon)); \
+			g_testFailureNum++; \
+		} \
+	} while (0)
+
+#define TEST_RESULT() (printf("%s\n", g_testFailureNum ? "FAILED" : "OK"), g_testFailureNum ? 1 : 0)
+
+namespace MG {
+
+	inline std::string GetTestAssetPath(const char* name)
+	{
+		return std::string(MG_TEST_ASSET_DIR) + name;
+	}
+
+	// ResourceToolDX::LoadModel̂m[hKw܂
+	inline Model* LoadTestModel(const char* name)
+	{
+		MGObject mgo = LoadMGO(GetTestAssetPath(name).c_str());
+		Model* model = new Model(0);
+		model->rawModel = GetModelByMGObject(mgo);
+		model->LoadNodeHierarchy();
+		return model;
+	}
+
+	// ResourceToolDX::LoadAnimationƓgݗ
+	inline Animation* LoadTestAnimation(const char* name)
+	{
+		MGObject mgo = LoadMGO(GetTestAssetPath(name).c_str());
+		Animation* animation = new Animation(0);
+		animation->rawAnimation = GetAnimationByMGObject(mgo);
+		for (unsigned int i = 0; i < animation->rawAnimation->channelNum; i++) {
+			animation->modelNodeChannels[animation->rawAnimation->channels[i].nodeName] = animation->rawAnimation->channels + i;
+		}
+		return animation;
+	}
+
+	inline void ReleaseTestModel(Model* model)
+	{
+		delete[] (char*)model->rawModel;
+		delete model;
+	}
+
+	inline void ReleaseTestAnimation(Animation* animation)
+	{
+		delete[] (char*)animation->rawAnimation;
+		delete animation;
+	}
+
+	// oߎԁi~bj
+	class TestTimer {
+	private:
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	public:
+		double GetMilliseconds() const
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+	};
+
+} // namespace MG
+
+#endif